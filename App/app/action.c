@@ -21,6 +21,9 @@
 #include "app/fm.h"
 #endif
 #include "app/scanner.h"
+#if defined(ENABLE_SPECTRUM)
+#include "app/spectrum.h"
+#endif
 #include "audio.h"
 #include "driver/bk1080.h"
 #include "driver/bk4819.h"
@@ -222,6 +225,23 @@ void ACTION_FM(void)
 }
 #endif
 
+#if defined(ENABLE_SPECTRUM)
+static void ACTION_Spectrum(void)
+{
+    if (gCurrentFunction == FUNCTION_TRANSMIT || gScanState != SCAN_OFF
+#if defined(ENABLE_FMRADIO)
+        || gFmRadioMode
+#endif
+    )
+    {
+        gBeepToPlay = BEEP_500HZ_60MS_DOUBLE_BEEP_OPTIONAL;
+        return;
+    }
+    gInputBoxIndex = 0;
+    SPECTRUM_Start();
+}
+#endif
+
 void ACTION_Handle(KEY_Code_t Key, bool bKeyPressed, bool bKeyHeld)
 {
     uint8_t Short;
@@ -308,6 +328,11 @@ void ACTION_Handle(KEY_Code_t Key, bool bKeyPressed, bool bKeyHeld)
     case 8:
 #if defined(ENABLE_TX1750)
         ACTION_AlarmOr1750(true);
+#endif
+        break;
+    case 9:
+#if defined(ENABLE_SPECTRUM)
+        ACTION_Spectrum();
 #endif
         break;
     }
@@ -14,6 +14,7 @@
  *     limitations under the License.
  */
 
+#include <string.h>
 #include "app/aircopy.h"
 #include "audio.h"
 #include "driver/bk4819.h"
@@ -28,38 +29,476 @@
 
 static const uint16_t Obfuscation[8] = { 0x6C16, 0xE614, 0x912E, 0x400D, 0x3521, 0x40D5, 0x0313, 0x80E9 };
 
+// Legacy mode: one 64 byte block per 36 word frame, 0x78 blocks, no feedback.
+//
+// V2 mode: frames fill the 128 byte FSK FIFO (64 words), which carries
+// 120 bytes of payload, so the 0x1E00 byte image is exactly 64 frames.
+// Word 1 holds the frame type and number. The receiver keeps a bitmap of
+// the frames it got. After a pass (or when the frames stop), it transmits
+// a request frame with the bitmap of missing frames. The sender listens
+// for a while after each pass and then resends only those frames.
+//
+// Frames that are all 0xFF (empty channel slots, unused areas) are not
+// sent. Each pass ends with a map frame listing them, which the receiver
+// expands to 0xFF in EEPROM.
+//
+// The receiver doesn't write to EEPROM while handling a frame. Payloads
+// are split at EEPROM page boundaries into a staging queue, and one page
+// is committed per tick without waiting for its write cycle. A frame that
+// doesn't fit in the queue is dropped (V2 asks for it again).
+#define AIRCOPY_V1_FRAME_WORDS	36U
+#define AIRCOPY_V1_BLOCKS	0x78U
+#define AIRCOPY_V2_FRAME_WORDS	64U
+#define AIRCOPY_V2_PAYLOAD	120U
+#define AIRCOPY_V2_FRAMES	64U
+
+#define AIRCOPY_V2_TYPE_MASK	0xFF00U
+#define AIRCOPY_V2_TYPE_DATA	0x2000U
+#define AIRCOPY_V2_TYPE_REQUEST	0x2100U
+#define AIRCOPY_V2_TYPE_MAP	0x2200U
+#define AIRCOPY_V2_LAST		0x0080U
+#define AIRCOPY_V2_FRAME_MASK	0x003FU
+
+// In 10 ms ticks
+#define AIRCOPY_V2_LISTEN_TIME	500U
+#define AIRCOPY_V2_REQUEST_LAST	50U
+#define AIRCOPY_V2_REQUEST_IDLE	250U
+#define AIRCOPY_V2_REQUEST_RETRY	600U
+#define AIRCOPY_V2_REQUESTS	8U
+
+// Two V2 frames, or two legacy blocks and a bit
+#define AIRCOPY_STAGE_PAGES	10U
+
+typedef struct {
+	uint16_t Address;
+	uint8_t Size;
+	uint8_t Data[EEPROM_PAGE_SIZE];
+} AIRCOPY_Page_t;
+
 AIRCOPY_State_t gAircopyState;
+AIRCOPY_Mode_t gAircopyMode;
 uint16_t gAirCopyBlockNumber;
 uint16_t gErrorsDuringAirCopy;
 uint8_t gAirCopyIsSendMode;
+uint16_t gAircopyDroppedFrames;
 
-uint16_t g_FSK_Buffer[36];
+uint16_t g_FSK_Buffer[AIRCOPY_FRAME_WORDS_MAX];
 
-void AIRCOPY_SendMessage(void)
+// The next frame is read and obfuscated while the current one is on air.
+// The receiver builds its resend requests here.
+static uint16_t gAircopyNextFrame[AIRCOPY_FRAME_WORDS_MAX];
+static uint8_t gAircopyPrepared; // Frame in gAircopyNextFrame + 1, 0 = none
+static uint8_t gAircopyCursor;
+
+// V2: frames still to send (sender) or frames received (receiver)
+static uint16_t gAircopyFrames[AIRCOPY_V2_FRAMES / 16];
+// V2 sender: blank frames found so far
+static uint16_t gAircopyBlank[AIRCOPY_V2_FRAMES / 16];
+static uint16_t gAircopyListenCountdown;
+static uint16_t gAircopyRequestCountdown;
+static uint8_t gAircopyRequests;
+
+// Receiver: pages waiting to be written, and V2 frames still to blank
+static AIRCOPY_Page_t gAircopyStage[AIRCOPY_STAGE_PAGES];
+static uint8_t gAircopyStageHead;
+static uint8_t gAircopyStageCount;
+static uint16_t gAircopyBlankPending[AIRCOPY_V2_FRAMES / 16];
+static bool gAircopyCompletePending;
+
+static bool AIRCOPY_TestFrame(uint8_t Frame)
+{
+	return (gAircopyFrames[Frame >> 4] >> (Frame & 15)) & 1U;
+}
+
+uint8_t AIRCOPY_GetFrameWords(void)
+{
+	return gAircopyMode == AIRCOPY_MODE_V2 ? AIRCOPY_V2_FRAME_WORDS : AIRCOPY_V1_FRAME_WORDS;
+}
+
+// V2 counts the map frame as frame AIRCOPY_V2_FRAMES
+static uint8_t AIRCOPY_GetFrameCount(void)
+{
+	return gAircopyMode == AIRCOPY_MODE_V2 ? AIRCOPY_V2_FRAMES + 1 : AIRCOPY_V1_BLOCKS;
+}
+
+static uint8_t AIRCOPY_FindNext(uint8_t Frame)
+{
+	if (gAircopyMode == AIRCOPY_MODE_V2) {
+		while (Frame < AIRCOPY_V2_FRAMES && !AIRCOPY_TestFrame(Frame)) {
+			Frame++;
+		}
+	}
+	return Frame;
+}
+
+// Adds magic, CRC and trailer, and obfuscates the frame in place
+static void AIRCOPY_Seal(uint16_t *pFrame, uint8_t Words)
 {
 	uint8_t i;
 
-	g_FSK_Buffer[1] = (gAirCopyBlockNumber & 0x3FF) << 6;
-	EEPROM_ReadBuffer(g_FSK_Buffer[1], &g_FSK_Buffer[2], 64);
-	g_FSK_Buffer[34] = CRC_Calculate(&g_FSK_Buffer[1], 2 + 64);
-	for (i = 0; i < 34; i++) {
-		g_FSK_Buffer[i + 1] ^= Obfuscation[i % 8];
+	pFrame[0] = 0xABCD;
+	pFrame[Words - 2] = CRC_Calculate(&pFrame[1], (Words - 3) * 2);
+	pFrame[Words - 1] = 0xDCBA;
+	for (i = 0; i < Words - 2; i++) {
+		pFrame[i + 1] ^= Obfuscation[i % 8];
+	}
+}
+
+static bool AIRCOPY_Open(uint16_t *pFrame, uint8_t Words)
+{
+	uint8_t i;
+
+	if (pFrame[0] != 0xABCD || pFrame[Words - 1] != 0xDCBA) {
+		return false;
+	}
+	for (i = 0; i < Words - 2; i++) {
+		pFrame[i + 1] ^= Obfuscation[i % 8];
+	}
+	return pFrame[Words - 2] == CRC_Calculate(&pFrame[1], (Words - 3) * 2);
+}
+
+static bool AIRCOPY_IsBlank(const uint16_t *pData, uint8_t Words)
+{
+	uint8_t i;
+
+	for (i = 0; i < Words; i++) {
+		if (pData[i] != 0xFFFF) {
+			return false;
+		}
+	}
+	return true;
+}
+
+// Prepares `Frame`, or in V2 the first non-blank pending frame from there
+// on (the map frame if none is left), and moves the cursor to it
+static void AIRCOPY_PrepareFrame(uint8_t Frame)
+{
+	if (gAircopyMode == AIRCOPY_MODE_V2) {
+		while (Frame < AIRCOPY_V2_FRAMES) {
+			EEPROM_ReadBuffer(Frame * AIRCOPY_V2_PAYLOAD, &gAircopyNextFrame[2], AIRCOPY_V2_PAYLOAD);
+			if (!AIRCOPY_IsBlank(&gAircopyNextFrame[2], AIRCOPY_V2_PAYLOAD / 2)) {
+				break;
+			}
+			gAircopyBlank[Frame >> 4] |= 1U << (Frame & 15);
+			gAircopyFrames[Frame >> 4] &= ~(1U << (Frame & 15));
+			Frame = AIRCOPY_FindNext(Frame + 1);
+		}
+		if (Frame < AIRCOPY_V2_FRAMES) {
+			gAircopyNextFrame[1] = AIRCOPY_V2_TYPE_DATA | Frame;
+		} else {
+			memset(&gAircopyNextFrame[2], 0, AIRCOPY_V2_PAYLOAD);
+			gAircopyNextFrame[1] = AIRCOPY_V2_TYPE_MAP | AIRCOPY_V2_LAST;
+			memcpy(&gAircopyNextFrame[2], gAircopyBlank, sizeof(gAircopyBlank));
+		}
+	} else {
+		gAircopyNextFrame[1] = (Frame & 0x3FF) << 6;
+		EEPROM_ReadBuffer(gAircopyNextFrame[1], &gAircopyNextFrame[2], 64);
+	}
+	AIRCOPY_Seal(gAircopyNextFrame, AIRCOPY_GetFrameWords());
+	gAircopyPrepared = Frame + 1;
+	gAircopyCursor = Frame;
+}
+
+void AIRCOPY_StartSending(void)
+{
+	gAirCopyBlockNumber = 0;
+	gAircopyPrepared = 0;
+	gAircopyCursor = 0;
+	gAircopyListenCountdown = 0;
+	memset(gAircopyFrames, 0xFF, sizeof(gAircopyFrames));
+	memset(gAircopyBlank, 0, sizeof(gAircopyBlank));
+	AIRCOPY_SendMessage();
+}
+
+void AIRCOPY_SendMessage(void)
+{
+	const uint8_t Words = AIRCOPY_GetFrameWords();
+	uint8_t Frame;
+
+	if (gAircopyPrepared != gAircopyCursor + 1) {
+		AIRCOPY_PrepareFrame(gAircopyCursor);
 	}
-	if (++gAirCopyBlockNumber >= 0x78) {
-		gAircopyState = AIRCOPY_COMPLETE;
+	Frame = gAircopyCursor;
+	memcpy(g_FSK_Buffer, gAircopyNextFrame, Words * 2);
+	if (gAircopyMode == AIRCOPY_MODE_V2 && Frame < AIRCOPY_V2_FRAMES) {
+		gAircopyFrames[Frame >> 4] &= ~(1U << (Frame & 15));
 	}
+	gAirCopyBlockNumber++;
+
 	RADIO_SetTxParameters();
-	BK4819_SendFSKData(g_FSK_Buffer);
+	BK4819_StartFSKTx(g_FSK_Buffer, Words);
+
+	if (gAircopyMode == AIRCOPY_MODE_V2 && Frame == AIRCOPY_V2_FRAMES) {
+		gAircopyCursor = AIRCOPY_V2_FRAMES + 1;
+	} else {
+		gAircopyCursor = AIRCOPY_FindNext(Frame + 1);
+	}
+	if (gAircopyCursor < AIRCOPY_GetFrameCount()) {
+		AIRCOPY_PrepareFrame(gAircopyCursor);
+	}
+}
+
+static void AIRCOPY_SendRequest(void)
+{
+	uint8_t i;
+
+	memset(gAircopyNextFrame, 0, sizeof(gAircopyNextFrame));
+	gAircopyNextFrame[1] = AIRCOPY_V2_TYPE_REQUEST;
+	for (i = 0; i < AIRCOPY_V2_FRAMES / 16; i++) {
+		gAircopyNextFrame[2 + i] = ~gAircopyFrames[i];
+	}
+	AIRCOPY_Seal(gAircopyNextFrame, AIRCOPY_V2_FRAME_WORDS);
+	gAircopyPrepared = 0;
+	gAircopyRequests++;
+
+	RADIO_SetTxParameters();
+	BK4819_StartFSKTx(gAircopyNextFrame, AIRCOPY_V2_FRAME_WORDS);
+}
+
+static void AIRCOPY_EndMessage(void)
+{
 	BK4819_SetupPowerAmplifier(0, 0);
 	BK4819_ToggleGpioOut(BK4819_GPIO1_PIN29_PA_ENABLE, false);
+
+	if (gAirCopyIsSendMode == 0) {
+		// Resend request is out, back to receiving
+		gFSKWriteIndex = 0;
+		BK4819_PrepareFSKReceive();
+		gAircopyRequestCountdown = AIRCOPY_V2_REQUEST_RETRY;
+		return;
+	}
+
+	if (gAircopyCursor < AIRCOPY_GetFrameCount()) {
+		gAircopySendCountdown = 30;
+		return;
+	}
+
+	gAircopyState = AIRCOPY_COMPLETE;
+	if (gAircopyMode == AIRCOPY_MODE_V2) {
+		gFSKWriteIndex = 0;
+		BK4819_PrepareFSKReceive();
+		gAircopyListenCountdown = AIRCOPY_V2_LISTEN_TIME;
+	}
+}
+
+static uint8_t AIRCOPY_CountPages(uint16_t Offset, uint8_t Size)
+{
+	return ((Offset + Size - 1) / EEPROM_PAGE_SIZE) - (Offset / EEPROM_PAGE_SIZE) + 1;
+}
+
+static bool AIRCOPY_Stage(uint16_t Offset, const void *pData, uint8_t Size)
+{
+	const uint8_t *pBytes = (const uint8_t *)pData;
+
+	if (gAircopyStageCount + AIRCOPY_CountPages(Offset, Size) > AIRCOPY_STAGE_PAGES) {
+		return false;
+	}
+	while (Size) {
+		AIRCOPY_Page_t *pPage = &gAircopyStage[(gAircopyStageHead + gAircopyStageCount) % AIRCOPY_STAGE_PAGES];
+		uint8_t Length = EEPROM_PAGE_SIZE - (Offset % EEPROM_PAGE_SIZE);
+
+		if (Length > Size) {
+			Length = Size;
+		}
+		pPage->Address = Offset;
+		pPage->Size = Length;
+		if (pBytes) {
+			memcpy(pPage->Data, pBytes, Length);
+			pBytes += Length;
+		} else {
+			memset(pPage->Data, 0xFF, Length);
+		}
+		gAircopyStageCount++;
+		Offset += Length;
+		Size -= Length;
+	}
+	return true;
+}
+
+// Stages 0xFF over the pages of the next blank frame that aren't blank yet.
+// Returns false once no blank frame is left.
+static bool AIRCOPY_StageBlank(void)
+{
+	uint16_t Data[EEPROM_PAGE_SIZE / 2];
+	uint16_t Offset;
+	uint16_t End;
+	uint8_t Frame;
+
+	for (Frame = 0; Frame < AIRCOPY_V2_FRAMES; Frame++) {
+		if ((gAircopyBlankPending[Frame >> 4] >> (Frame & 15)) & 1U) {
+			break;
+		}
+	}
+	if (Frame == AIRCOPY_V2_FRAMES) {
+		return false;
+	}
+	gAircopyBlankPending[Frame >> 4] &= ~(1U << (Frame & 15));
+
+	Offset = Frame * AIRCOPY_V2_PAYLOAD;
+	End = Offset + AIRCOPY_V2_PAYLOAD;
+	while (Offset < End) {
+		uint8_t Length = EEPROM_PAGE_SIZE - (Offset % EEPROM_PAGE_SIZE);
+
+		if (Length > End - Offset) {
+			Length = End - Offset;
+		}
+		// Reading is much cheaper than a write cycle
+		EEPROM_ReadBuffer(Offset, Data, Length);
+		if (!AIRCOPY_IsBlank(Data, Length / 2)) {
+			AIRCOPY_Stage(Offset, NULL, Length);
+		}
+		Offset += Length;
+	}
+	return true;
+}
+
+static void AIRCOPY_Commit(void)
+{
+	const AIRCOPY_Page_t *pPage;
+
+	if (EEPROM_IsBusy()) {
+		return;
+	}
+	// A frame that is already blank here stages nothing, so go on to the
+	// next one; complete only once every blank frame has been looked at
+	while (gAircopyStageCount == 0 && AIRCOPY_StageBlank()) {
+	}
+	if (gAircopyStageCount == 0) {
+		if (gAircopyCompletePending) {
+			gAircopyCompletePending = false;
+			gAircopyState = AIRCOPY_COMPLETE;
+			gUpdateDisplay = true;
+		}
+		return;
+	}
+
+	pPage = &gAircopyStage[gAircopyStageHead];
+	EEPROM_StartWrite(pPage->Address, pPage->Data, pPage->Size);
+	RADIO_InvalidateChannelCache(0xFF);
+	gAircopyStageHead = (gAircopyStageHead + 1) % AIRCOPY_STAGE_PAGES;
+	gAircopyStageCount--;
+}
+
+bool AIRCOPY_IsReceiving(void)
+{
+	if (gScreenToDisplay != DISPLAY_AIRCOPY || BK4819_IsFSKTxBusy()) {
+		return false;
+	}
+	if (gAirCopyIsSendMode == 0) {
+		return gAircopyState == AIRCOPY_TRANSFER;
+	}
+	return gAircopyListenCountdown != 0;
+}
+
+void AIRCOPY_TimeSlice10ms(void)
+{
+	if (gScreenToDisplay != DISPLAY_AIRCOPY) {
+		return;
+	}
+
+	if (gAirCopyIsSendMode == 0) {
+		AIRCOPY_Commit();
+	}
+
+	if (BK4819_IsFSKTxBusy()) {
+		if (!BK4819_PollFSKTx()) {
+			AIRCOPY_EndMessage();
+			GUI_DisplayScreen();
+		}
+		return;
+	}
+
+	if (gAirCopyIsSendMode == 1) {
+		if (gAircopyState == AIRCOPY_TRANSFER && gAircopySendCountdown) {
+			gAircopySendCountdown--;
+			if (gAircopySendCountdown == 0) {
+				AIRCOPY_SendMessage();
+				GUI_DisplayScreen();
+			}
+		}
+		if (gAircopyListenCountdown) {
+			gAircopyListenCountdown--;
+		}
+	} else if (gAircopyState == AIRCOPY_TRANSFER && !gAircopyCompletePending && gAircopyRequestCountdown) {
+		gAircopyRequestCountdown--;
+		if (gAircopyRequestCountdown == 0 && gAircopyRequests < AIRCOPY_V2_REQUESTS) {
+			AIRCOPY_SendRequest();
+		}
+	}
+}
+
+static void AIRCOPY_StoreRequest(void)
+{
+	uint8_t i;
+
+	if (g_FSK_Buffer[1] != AIRCOPY_V2_TYPE_REQUEST) {
+		return;
+	}
+	for (i = 0; i < AIRCOPY_V2_FRAMES / 16; i++) {
+		gAircopyFrames[i] = g_FSK_Buffer[2 + i];
+	}
+	// Every resend pass ends with the map frame, so there's always
+	// something to send
+	gAircopyPrepared = 0;
+	gAircopyCursor = AIRCOPY_FindNext(0);
+	gAircopyListenCountdown = 0;
 	gAircopySendCountdown = 30;
+	gAircopyState = AIRCOPY_TRANSFER;
+}
+
+static void AIRCOPY_MarkFrame(uint8_t Frame)
+{
+	gAircopyFrames[Frame >> 4] |= 1U << (Frame & 15);
+	gAirCopyBlockNumber++;
+	gAircopyRequests = 0;
+}
+
+static bool AIRCOPY_StoreFrame(void)
+{
+	const uint16_t Header = g_FSK_Buffer[1];
+	uint8_t Frame;
+
+	switch (Header & AIRCOPY_V2_TYPE_MASK) {
+	case AIRCOPY_V2_TYPE_DATA:
+		Frame = Header & AIRCOPY_V2_FRAME_MASK;
+		if (!AIRCOPY_TestFrame(Frame)) {
+			if (!AIRCOPY_Stage(Frame * AIRCOPY_V2_PAYLOAD, &g_FSK_Buffer[2], AIRCOPY_V2_PAYLOAD)) {
+				gAircopyDroppedFrames++;
+			} else {
+				AIRCOPY_MarkFrame(Frame);
+			}
+		}
+		break;
+
+	case AIRCOPY_V2_TYPE_MAP:
+		for (Frame = 0; Frame < AIRCOPY_V2_FRAMES; Frame++) {
+			if (((g_FSK_Buffer[2 + (Frame >> 4)] >> (Frame & 15)) & 1U) && !AIRCOPY_TestFrame(Frame)) {
+				gAircopyBlankPending[Frame >> 4] |= 1U << (Frame & 15);
+				AIRCOPY_MarkFrame(Frame);
+			}
+		}
+		break;
+
+	default:
+		return false;
+	}
+
+	if (gAirCopyBlockNumber == AIRCOPY_V2_FRAMES) {
+		gAircopyRequestCountdown = 0;
+		gAircopyCompletePending = true;
+	} else if (Header & AIRCOPY_V2_LAST) {
+		gAircopyRequestCountdown = AIRCOPY_V2_REQUEST_LAST;
+	}
+
+	return true;
 }
 
 void AIRCOPY_StorePacket(void)
 {
+	const uint8_t Words = AIRCOPY_GetFrameWords();
 	uint16_t Status;
 
-	if (gFSKWriteIndex < 36) {
+	if (gFSKWriteIndex < Words) {
 		return;
 	}
 
@@ -67,34 +506,39 @@ void AIRCOPY_StorePacket(void)
 	gUpdateDisplay = true;
 	Status = BK4819_ReadRegister(BK4819_REG_0B);
 	BK4819_PrepareFSKReceive();
+
+	if (gAircopyMode == AIRCOPY_MODE_V2) {
+		if (gAirCopyIsSendMode == 0) {
+			// Whatever arrived, the sender is still around
+			gAircopyRequestCountdown = AIRCOPY_V2_REQUEST_IDLE;
+		}
+		if ((Status & 0x0010U) == 0 && AIRCOPY_Open(g_FSK_Buffer, Words)) {
+			if (gAirCopyIsSendMode == 1) {
+				AIRCOPY_StoreRequest();
+				return;
+			}
+			if (AIRCOPY_StoreFrame()) {
+				return;
+			}
+		}
+		gErrorsDuringAirCopy++;
+		return;
+	}
+
 	// Doc says bit 4 should be 1 = CRC OK, 0 = CRC FAIL, but original firmware checks for FAIL.
-	if ((Status & 0x0010U) == 0 && g_FSK_Buffer[0] == 0xABCD && g_FSK_Buffer[35] == 0xDCBA) {
-		uint16_t CRC;
-		uint8_t i;
+	if ((Status & 0x0010U) == 0 && AIRCOPY_Open(g_FSK_Buffer, Words)) {
+		const uint16_t Offset = g_FSK_Buffer[1];
 
-		for (i = 0; i < 34; i++) {
-			g_FSK_Buffer[i + 1] ^= Obfuscation[i % 8];
-		}
-
-		CRC = CRC_Calculate(&g_FSK_Buffer[1], 2 + 64);
-		if (g_FSK_Buffer[34] == CRC) {
-			const uint16_t *pData;
-			uint16_t Offset;
-
-			Offset = g_FSK_Buffer[1];
-			if (Offset < 0x1E00) {
-				pData = &g_FSK_Buffer[2];
-				for (i = 0; i < 8; i++) {
-					EEPROM_WriteBuffer(Offset, pData);
-					pData += 4;
-					Offset += 8;
-				}
-				if (Offset == 0x1E00) {
-					gAircopyState = AIRCOPY_COMPLETE;
-				}
-				gAirCopyBlockNumber++;
+		if (Offset < 0x1E00) {
+			if (!AIRCOPY_Stage(Offset, &g_FSK_Buffer[2], 64)) {
+				gAircopyDroppedFrames++;
 				return;
 			}
+			if (Offset + 64 == 0x1E00) {
+				gAircopyCompletePending = true;
+			}
+			gAirCopyBlockNumber++;
+			return;
 		}
 	}
 	gErrorsDuringAirCopy++;
@@ -126,6 +570,7 @@ static void AIRCOPY_Key_DIGITS(KEY_Code_t Key, bool bKeyPressed, bool bKeyHeld)
 				gCurrentVfo = gRxVfo;
 				RADIO_SetupRegisters(true);
 				BK4819_SetupAircopy();
+				BK4819_SetFSKFrameLength(AIRCOPY_GetFrameWords() * 2);
 				BK4819_ResetFSK();
 				return;
 			}
@@ -141,8 +586,15 @@ static void AIRCOPY_Key_EXIT(bool bKeyPressed, bool bKeyHeld)
 			gFSKWriteIndex = 0;
 			gAirCopyBlockNumber = 0;
 			gErrorsDuringAirCopy = 0;
+			gAircopyDroppedFrames = 0;
 			gInputBoxIndex = 0;
 			gAirCopyIsSendMode = 0;
+			memset(gAircopyFrames, 0, sizeof(gAircopyFrames));
+			gAircopyRequestCountdown = 0;
+			gAircopyRequests = 0;
+			gAircopyStageCount = 0;
+			memset(gAircopyBlankPending, 0, sizeof(gAircopyBlankPending));
+			gAircopyCompletePending = false;
 			BK4819_PrepareFSKReceive();
 			gAircopyState = AIRCOPY_TRANSFER;
 		} else {
@@ -157,18 +609,24 @@ static void AIRCOPY_Key_MENU(bool bKeyPressed, bool bKeyHeld)
 {
 	if (!bKeyHeld && bKeyPressed) {
 		gFSKWriteIndex = 0;
-		gAirCopyBlockNumber = 0;
 		gInputBoxIndex = 0;
 		gAirCopyIsSendMode = 1;
-		g_FSK_Buffer[0] = 0xABCD;
-		g_FSK_Buffer[1] = 0;
-		g_FSK_Buffer[35] = 0xDCBA;
-		AIRCOPY_SendMessage();
+		AIRCOPY_StartSending();
 		GUI_DisplayScreen();
 		gAircopyState = AIRCOPY_TRANSFER;
 	}
 }
 
+static void AIRCOPY_Key_STAR(bool bKeyPressed, bool bKeyHeld)
+{
+	// The frame size and count can't change under a running transfer
+	if (!bKeyHeld && bKeyPressed && gInputBoxIndex == 0 && gAircopyState == AIRCOPY_READY) {
+		gAircopyMode = (gAircopyMode == AIRCOPY_MODE_V2) ? AIRCOPY_MODE_LEGACY : AIRCOPY_MODE_V2;
+		BK4819_SetFSKFrameLength(AIRCOPY_GetFrameWords() * 2);
+		gRequestDisplayScreen = DISPLAY_AIRCOPY;
+	}
+}
+
 void AIRCOPY_ProcessKeys(KEY_Code_t Key, bool bKeyPressed, bool bKeyHeld)
 {
 	switch (Key) {
@@ -183,6 +641,9 @@ void AIRCOPY_ProcessKeys(KEY_Code_t Key, bool bKeyPressed, bool bKeyHeld)
 	case KEY_EXIT:
 		AIRCOPY_Key_EXIT(bKeyPressed, bKeyHeld);
 		break;
+	case KEY_STAR:
+		AIRCOPY_Key_STAR(bKeyPressed, bKeyHeld);
+		break;
 	default:
 		break;
 	}
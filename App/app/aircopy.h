@@ -27,14 +27,29 @@ enum AIRCOPY_State_t {
 
 typedef enum AIRCOPY_State_t AIRCOPY_State_t;
 
+enum AIRCOPY_Mode_t {
+	AIRCOPY_MODE_LEGACY	= 0U,
+	AIRCOPY_MODE_V2		= 1U,
+};
+
+typedef enum AIRCOPY_Mode_t AIRCOPY_Mode_t;
+
+#define AIRCOPY_FRAME_WORDS_MAX	64U
+
 extern AIRCOPY_State_t gAircopyState;
+extern AIRCOPY_Mode_t gAircopyMode;
 extern uint16_t gAirCopyBlockNumber;
 extern uint16_t gErrorsDuringAirCopy;
 extern uint8_t gAirCopyIsSendMode;
+extern uint16_t gAircopyDroppedFrames;
 
-extern uint16_t g_FSK_Buffer[36];
+extern uint16_t g_FSK_Buffer[AIRCOPY_FRAME_WORDS_MAX];
 
+uint8_t AIRCOPY_GetFrameWords(void);
+void AIRCOPY_StartSending(void);
 void AIRCOPY_SendMessage(void);
+bool AIRCOPY_IsReceiving(void);
+void AIRCOPY_TimeSlice10ms(void);
 void AIRCOPY_StorePacket(void);
 
 void AIRCOPY_ProcessKeys(KEY_Code_t Key, bool bKeyPressed, bool bKeyHeld);
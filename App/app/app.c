@@ -28,6 +28,9 @@
 #include "app/main.h"
 #include "app/menu.h"
 #include "app/scanner.h"
+#if defined(ENABLE_SPECTRUM)
+#include "app/spectrum.h"
+#endif
 #if defined(ENABLE_UART)
 #include "app/uart.h"
 #endif
@@ -44,6 +47,7 @@
 #include "driver/st7565.h"
 #include "driver/system.h"
 #include "driver/board.h"
+#include "driver/voice.h"
 #include "dtmf.h"
 #include "frequencies.h"
 #include "functions.h"
@@ -63,6 +67,17 @@
 
 static void APP_ProcessKey(KEY_Code_t Key, bool bKeyPressed, bool bKeyHeld);
 
+#if defined(ENABLE_FAST_SCAN)
+// 10 ms ticks after a scan hop before the channel is sampled
+#define SCAN_PREFILTER_DELAY 3U
+
+static uint8_t gScanPrefilterCountdown;
+#endif
+
+// Memory channel the scan is expected to visit next, read into the channel
+// cache on the next 10 ms tick while the current one dwells
+static uint8_t gScanPrefetchChannel = 0xFF;
+
 static void APP_CheckForIncoming(void)
 {
     if (!g_SquelchLost)
@@ -445,32 +460,24 @@ void APP_StartListening(FUNCTION_Type_t Function)
 
 void APP_SetFrequencyByStep(VFO_Info_t *pInfo, int8_t Step)
 {
+    const uint32_t Lower = LowerLimitFrequencyBandTable[pInfo->Band];
+    const uint32_t Upper = UpperLimitFrequencyBandTable[pInfo->Band];
     uint32_t Frequency;
 
     Frequency = pInfo->ConfigRX.Frequency + (Step * pInfo->StepFrequency);
 
     if (pInfo->StepFrequency == 833)
     {
-        const uint32_t Lower = LowerLimitFrequencyBandTable[pInfo->Band];
-        const uint32_t Delta = Frequency - Lower;
-        uint32_t Base = (Delta / 2500) * 2500;
-        const uint32_t Index = ((Delta - Base) % 2500) / 833;
-
-        if (Index == 2)
-        {
-            Base++;
-        }
-
-        Frequency = Lower + Base + (Index * 833);
+        Frequency = FREQUENCY_FloorToStep(Frequency, 833, Lower);
     }
 
-    if (Frequency > UpperLimitFrequencyBandTable[pInfo->Band])
+    if (Frequency > Upper)
     {
-        pInfo->ConfigRX.Frequency = LowerLimitFrequencyBandTable[pInfo->Band];
+        pInfo->ConfigRX.Frequency = Lower;
     }
-    else if (Frequency < LowerLimitFrequencyBandTable[pInfo->Band])
+    else if (Frequency < Lower)
     {
-        pInfo->ConfigRX.Frequency = FREQUENCY_FloorToStep(UpperLimitFrequencyBandTable[pInfo->Band], pInfo->StepFrequency, LowerLimitFrequencyBandTable[pInfo->Band]);
+        pInfo->ConfigRX.Frequency = FREQUENCY_FloorToStep(Upper, pInfo->StepFrequency, Lower);
     }
     else
     {
@@ -486,6 +493,9 @@ static void FREQ_NextChannel(void)
     RADIO_SetupRegisters(true);
     gUpdateDisplay = true;
     ScanPauseDelayIn10msec = 10;
+#if defined(ENABLE_FAST_SCAN)
+    gScanPrefilterCountdown = SCAN_PREFILTER_DELAY;
+#endif
     bScanKeepFrequency = false;
 }
 
@@ -555,7 +565,11 @@ static void MR_NextChannel(void)
         gUpdateDisplay = true;
     }
     ScanPauseDelayIn10msec = 20;
+#if defined(ENABLE_FAST_SCAN)
+    gScanPrefilterCountdown = SCAN_PREFILTER_DELAY;
+#endif
     bScanKeepFrequency = false;
+    gScanPrefetchChannel = RADIO_FindNextChannel(((bEnabled && gCurrentScanList != 2) ? gPreviousMrChannel : gNextMrChannel) + gScanState, gScanState, true, gEeprom.SCAN_LIST_DEFAULT);
     if (bEnabled)
     {
         gCurrentScanList++;
@@ -621,6 +635,19 @@ void APP_CheckRadioInterrupts(void)
     {
         return;
     }
+#if defined(ENABLE_SPECTRUM)
+    if (gScreenToDisplay == DISPLAY_SPECTRUM)
+    {
+        return;
+    }
+#endif
+#if defined(ENABLE_AIRCOPY)
+    if (BK4819_IsFSKTxBusy())
+    {
+        // BK4819_PollFSKTx() waits for the TX finished interrupt
+        return;
+    }
+#endif
 
     while (BK4819_ReadRegister(BK4819_REG_0C) & 1U)
     {
@@ -632,16 +659,7 @@ void APP_CheckRadioInterrupts(void)
         {
             gDTMF_RequestPending = true;
             gDTMF_RecvTimeout = 5;
-            if (gDTMF_WriteIndex > 15)
-            {
-                uint8_t i;
-                for (i = 0; i < sizeof(gDTMF_Received) - 1; i++)
-                {
-                    gDTMF_Received[i] = gDTMF_Received[i + 1];
-                }
-                gDTMF_WriteIndex = 15;
-            }
-            gDTMF_Received[gDTMF_WriteIndex++] = DTMF_GetCharacter(BK4819_GetDTMF_5TONE_Code());
+            DTMF_Receive(BK4819_GetDTMF_5TONE_Code());
             if (gCurrentFunction == FUNCTION_RECEIVE)
             {
                 DTMF_HandleRequest();
@@ -702,7 +720,7 @@ void APP_CheckRadioInterrupts(void)
             BK4819_ToggleGpioOut(BK4819_GPIO6_PIN2_GREEN, false);
         }
 #if defined(ENABLE_AIRCOPY)
-        if (Mask & BK4819_REG_02_FSK_FIFO_ALMOST_FULL && gScreenToDisplay == DISPLAY_AIRCOPY && gAircopyState == AIRCOPY_TRANSFER && gAirCopyIsSendMode == 0)
+        if (Mask & BK4819_REG_02_FSK_FIFO_ALMOST_FULL && AIRCOPY_IsReceiving())
         {
             uint8_t i;
 
@@ -796,6 +814,62 @@ static void APP_HandleVox(void)
     }
 }
 
+#if defined(ENABLE_KEYPAD_WAKE)
+// Takes the first sample of a new key press as soon as the keypad wake
+// interrupt fires, instead of waiting for the next 10 ms slice. Debouncing
+// is still counted by APP_CheckKeys from the timer slices.
+static void APP_SampleKeysOnWake(void)
+{
+    KEY_Code_t Key;
+
+    if (VOICE_IsBusy())
+    {
+        return;
+    }
+
+    gKeyboardWakePending = false;
+    if (gKeyReading0 != KEY_INVALID)
+    {
+        return;
+    }
+
+    Key = KEYBOARD_Poll();
+    if (Key != KEY_INVALID)
+    {
+        gKeyReading0 = Key;
+        gDebounceCounter = 0;
+    }
+}
+#endif
+
+#if defined(ENABLE_FAST_SCAN)
+// Samples the channel once shortly after a scan hop and moves on right away
+// when it's clearly empty, i.e. the squelch would not even stay open on it
+// (the close thresholds of the per band squelch calibration). Anything
+// else waits out the full dwell for the squelch interrupt.
+static void APP_ScanPrefilter(void)
+{
+    uint16_t Rssi;
+    uint8_t Noise;
+    uint8_t Glitch;
+
+    if (gScanState == SCAN_OFF || gScanPauseMode || gRxReceptionMode != RX_MODE_NONE || gCurrentFunction != FUNCTION_FOREGROUND)
+    {
+        return;
+    }
+
+    Rssi = BK4819_GetRSSI();
+    Noise = BK4819_ReadRegister(BK4819_REG_65) & 0x007F;
+    Glitch = BK4819_ReadRegister(BK4819_REG_63) & 0x00FF;
+
+    if (Rssi < gRxVfo->SquelchCloseRSSI || Noise > gRxVfo->SquelchCloseNoise || Glitch > gRxVfo->SquelchCloseGlitch)
+    {
+        ScanPauseDelayIn10msec = 0;
+        gScheduleScanListen = true;
+    }
+}
+#endif
+
 void APP_Update(void)
 {
     if (gFlagPlayQueuedVoice)
@@ -818,6 +892,20 @@ void APP_Update(void)
     {
         return;
     }
+#if defined(ENABLE_KEYPAD_WAKE)
+    if (gKeyboardWakePending)
+    {
+        APP_SampleKeysOnWake();
+    }
+#endif
+#if defined(ENABLE_SPECTRUM)
+    if (gScreenToDisplay == DISPLAY_SPECTRUM)
+    {
+        // The sweep owns the BK4819, no scanning, dual watch or power save
+        SPECTRUM_Update();
+        return;
+    }
+#endif
     if (gCurrentFunction != FUNCTION_TRANSMIT)
     {
         APP_HandleFunction();
@@ -1028,6 +1116,18 @@ void APP_CheckKeys(void)
             gPttDebounceCounter = 0;
         }
     }
+    if (VOICE_IsBusy())
+    {
+        // Keyboard rows 6 / 7 are clocking out a voice ID
+        return;
+    }
+#if defined(ENABLE_KEYPAD_WAKE)
+    if (gKeyReading0 == KEY_INVALID && gDebounceCounter >= 2 && !KEYBOARD_IsAnyKeyDown())
+    {
+        // Idle keypad, skip the matrix scan
+        return;
+    }
+#endif
     Key = KEYBOARD_Poll();
     if (gKeyReading0 != Key)
     {
@@ -1087,6 +1187,9 @@ void APP_TimeSlice10ms(void)
 {
     gFlashLightBlinkCounter++;
 
+    AUDIO_TimeSlice10ms();
+    DTMF_TimeSlice10ms();
+
 #if defined(ENABLE_UART)
     if (UART_IsCommandAvailable())
     {
@@ -1106,6 +1209,26 @@ void APP_TimeSlice10ms(void)
         APP_CheckRadioInterrupts();
     }
 
+#if defined(ENABLE_FAST_SCAN)
+    if (gScanPrefilterCountdown)
+    {
+        gScanPrefilterCountdown--;
+        if (gScanPrefilterCountdown == 0)
+        {
+            APP_ScanPrefilter();
+        }
+    }
+#endif
+
+    if (gScanPrefetchChannel != 0xFF)
+    {
+        if (gScanState != SCAN_OFF)
+        {
+            RADIO_PrefetchChannel(gScanPrefetchChannel);
+        }
+        gScanPrefetchChannel = 0xFF;
+    }
+
     if (gCurrentFunction != FUNCTION_TRANSMIT)
     {
         if (gUpdateStatus)
@@ -1327,18 +1450,7 @@ void APP_TimeSlice10ms(void)
     }
 
 #if defined(ENABLE_AIRCOPY)
-    if (gScreenToDisplay == DISPLAY_AIRCOPY && gAircopyState == AIRCOPY_TRANSFER && gAirCopyIsSendMode == 1)
-    {
-        if (gAircopySendCountdown)
-        {
-            gAircopySendCountdown--;
-            if (gAircopySendCountdown == 0)
-            {
-                AIRCOPY_SendMessage();
-                GUI_DisplayScreen();
-            }
-        }
-    }
+    AIRCOPY_TimeSlice10ms();
 #endif
 
     APP_CheckKeys();
@@ -1389,11 +1501,6 @@ void APP_TimeSlice500ms(void)
     {
         if ((gBatteryCheckCounter & 1) == 0)
         {
-            BOARD_ADC_GetBatteryInfo(&gBatteryVoltages[gBatteryVoltageIndex++], &gBatteryCurrent);
-            if (gBatteryVoltageIndex > 3)
-            {
-                gBatteryVoltageIndex = 0;
-            }
             BATTERY_GetReadings(true);
         }
         if (gCurrentFunction != FUNCTION_POWER_SAVE)
@@ -1419,6 +1526,9 @@ void APP_TimeSlice500ms(void)
             if (gScanState == SCAN_OFF
 #if defined(ENABLE_AIRCOPY)
                 && gScreenToDisplay != DISPLAY_AIRCOPY
+#endif
+#if defined(ENABLE_SPECTRUM)
+                && gScreenToDisplay != DISPLAY_SPECTRUM
 #endif
                 && (gScreenToDisplay != DISPLAY_SCANNER || (gScanCssState >= SCAN_CSS_STATE_FOUND)))
             {
@@ -1498,7 +1608,7 @@ void APP_TimeSlice500ms(void)
             {
                 if (gLowBatteryCountdown == 29 && !gChargingWithTypeC)
                 {
-                    AUDIO_PlayBeep(BEEP_500HZ_60MS_DOUBLE_BEEP);
+                    AUDIO_QueueBeep(BEEP_500HZ_60MS_DOUBLE_BEEP);
                 }
             }
             else
@@ -1559,7 +1669,7 @@ void APP_TimeSlice500ms(void)
             gDTMF_DecodeRingCountdown--;
             if ((gDTMF_DecodeRingCountdown % 3) == 0)
             {
-                AUDIO_PlayBeep(BEEP_440HZ_500MS);
+                AUDIO_QueueBeep(BEEP_440HZ_500MS);
             }
             if (gDTMF_DecodeRingCountdown == 0)
             {
@@ -1583,8 +1693,7 @@ void APP_TimeSlice500ms(void)
         gDTMF_RecvTimeout--;
         if (gDTMF_RecvTimeout == 0)
         {
-            gDTMF_WriteIndex = 0;
-            memset(gDTMF_Received, 0, sizeof(gDTMF_Received));
+            DTMF_ClearReceived();
         }
     }
 }
@@ -1852,6 +1961,7 @@ static void APP_ProcessKey(KEY_Code_t Key, bool bKeyPressed, bool bKeyHeld)
                     }
                     else
                     {
+                        DTMF_FinishTx();
                         if (gEeprom.DTMF_SIDE_TONE)
                         {
                             // GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_AUDIO_PATH);
@@ -1915,6 +2025,11 @@ static void APP_ProcessKey(KEY_Code_t Key, bool bKeyPressed, bool bKeyHeld)
             case DISPLAY_AIRCOPY:
                 AIRCOPY_ProcessKeys(Key, bKeyPressed, bKeyHeld);
                 break;
+#endif
+#if defined(ENABLE_SPECTRUM)
+            case DISPLAY_SPECTRUM:
+                SPECTRUM_ProcessKeys(Key, bKeyPressed, bKeyHeld);
+                break;
 #endif
             default:
                 break;
@@ -1923,6 +2038,9 @@ static void APP_ProcessKey(KEY_Code_t Key, bool bKeyPressed, bool bKeyHeld)
         else if (gScreenToDisplay != DISPLAY_SCANNER
 #if defined(ENABLE_AIRCOPY)
                  && gScreenToDisplay != DISPLAY_AIRCOPY
+#endif
+#if defined(ENABLE_SPECTRUM)
+                 && gScreenToDisplay != DISPLAY_SPECTRUM
 #endif
         )
         {
@@ -1937,7 +2055,7 @@ static void APP_ProcessKey(KEY_Code_t Key, bool bKeyPressed, bool bKeyHeld)
 Skip:
     if (gBeepToPlay)
     {
-        AUDIO_PlayBeep(gBeepToPlay);
+        AUDIO_QueueBeep(gBeepToPlay);
         gBeepToPlay = BEEP_NONE;
     }
 
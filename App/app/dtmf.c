@@ -53,6 +53,39 @@ bool gDTMF_IsTx;
 uint8_t gDTMF_TxStopCountdown;
 bool gDTMF_IsGroupCall;
 
+// IDs of the contacts at 0x1C00 (16 bytes each: 8 name, 3 ID), up to the
+// first one without a valid name, so that DTMF_FindContact() doesn't walk
+// the EEPROM on every redraw. Built by DTMF_LoadContactIndex().
+static char gDTMF_ContactID[16][3];
+static uint8_t gDTMF_ContactCount;
+
+// The codes DTMF_HandleRequest() looks for at the end of the received
+// digits. Each template is compiled once into a mask per DTMF code (bit i:
+// position i accepts that code) and every received digit advances a
+// shift-and state (bit i: the last i + 1 digits match the first i + 1
+// positions), so a match is a bit test instead of a sprintf and a compare.
+enum {
+    DTMF_TEMPLATE_KILL = 0,
+    DTMF_TEMPLATE_REVIVE,
+    DTMF_TEMPLATE_AB,
+    DTMF_TEMPLATE_CALL_OUT,
+    DTMF_TEMPLATE_CALL_IN,
+    DTMF_TEMPLATE_COUNT,
+};
+
+typedef struct
+{
+    uint16_t Mask[16];
+    uint16_t Any;    // Positions that accept any digit
+    uint16_t Exact;  // State: matches without the group call code
+    uint16_t Group;  // State: matches that needed the group call code somewhere
+    uint8_t Size;
+    bool bCheckGroup;
+} DTMF_Template_t;
+
+static DTMF_Template_t gDTMF_Templates[DTMF_TEMPLATE_COUNT];
+static uint8_t gDTMF_GroupCode;
+
 bool DTMF_ValidateCodes(char *pCode, uint8_t Size)
 {
     uint8_t i;
@@ -89,27 +122,31 @@ bool DTMF_GetContact(uint8_t Index, char *pContact)
     return true;
 }
 
-bool DTMF_FindContact(const char *pContact, char *pResult)
+void DTMF_LoadContactIndex(void)
 {
     char Contact[16];
-    uint8_t i, j;
+    uint8_t i;
 
     for (i = 0; i < 16; i++)
     {
         if (!DTMF_GetContact(i, Contact))
         {
-            return false;
-        }
-        for (j = 0; j < 3; j++)
-        {
-            if (pContact[j] != Contact[j + 8])
-            {
-                break;
-            }
+            break;
         }
-        if (j == 3)
+        memcpy(gDTMF_ContactID[i], Contact + 8, 3);
+    }
+    gDTMF_ContactCount = i;
+}
+
+bool DTMF_FindContact(const char *pContact, char *pResult)
+{
+    uint8_t i;
+
+    for (i = 0; i < gDTMF_ContactCount; i++)
+    {
+        if (memcmp(pContact, gDTMF_ContactID[i], 3) == 0)
         {
-            memcpy(pResult, Contact, 8);
+            EEPROM_ReadBuffer(0x1C00 + (i * 0x10), pResult, 8);
             pResult[8] = 0;
             return true;
         }
@@ -150,23 +187,155 @@ char DTMF_GetCharacter(uint8_t Code)
     return 0xFF;
 }
 
-bool DTMF_CompareMessage(const char *pMsg, const char *pTemplate, uint8_t Size, bool bCheckGroup)
+static uint8_t DTMF_GetCode(char Character)
 {
+    if (Character >= '0' && Character <= '9')
+    {
+        return Character - '0';
+    }
+    if (Character >= 'A' && Character <= 'D')
+    {
+        return 10 + (Character - 'A');
+    }
+    if (Character == '*')
+    {
+        return 14;
+    }
+    if (Character == '#')
+    {
+        return 15;
+    }
+
+    return 0xFF;
+}
+
+static void DTMF_Compile(uint8_t Index, const char *pString, uint8_t Size, uint8_t AnyFrom, bool bCheckGroup)
+{
+    DTMF_Template_t *pTemplate = &gDTMF_Templates[Index];
     uint8_t i;
 
+    memset(pTemplate, 0, sizeof(*pTemplate));
     for (i = 0; i < Size; i++)
     {
-        if (pMsg[i] != pTemplate[i])
+        const uint8_t Code = DTMF_GetCode(pString[i]);
+
+        if (i >= AnyFrom)
         {
-            if (!bCheckGroup || pMsg[i] != gEeprom.DTMF_GROUP_CALL_CODE)
-            {
-                return false;
-            }
-            gDTMF_IsGroupCall = true;
+            pTemplate->Any |= 1U << i;
+        }
+        else if (Code < 16)
+        {
+            pTemplate->Mask[Code] |= 1U << i;
         }
     }
+    pTemplate->Size = Size;
+    pTemplate->bCheckGroup = bCheckGroup;
+}
 
-    return true;
+static void DTMF_Advance(DTMF_Template_t *pTemplate, uint8_t Code)
+{
+    const uint16_t Shifted = (pTemplate->Exact << 1) | 1U;
+    uint16_t Exact;
+    uint16_t Wild;
+
+    Exact = pTemplate->Any;
+    Wild = 0;
+    if (Code < 16)
+    {
+        Exact |= pTemplate->Mask[Code];
+        // The group call code stands in for any other digit
+        if (pTemplate->bCheckGroup && Code == gDTMF_GroupCode)
+        {
+            Wild = ~Exact;
+        }
+    }
+
+    pTemplate->Group = ((pTemplate->Group << 1) & (Exact | Wild)) | (Shifted & Wild);
+    pTemplate->Exact = Shifted & Exact;
+}
+
+static bool DTMF_IsMatch(uint8_t Index, bool *pbGroup)
+{
+    const DTMF_Template_t *pTemplate = &gDTMF_Templates[Index];
+    const uint16_t Bit = 1U << (pTemplate->Size - 1);
+
+    if (pTemplate->Exact & Bit)
+    {
+        *pbGroup = false;
+        return true;
+    }
+    if (pTemplate->Group & Bit)
+    {
+        *pbGroup = true;
+        return true;
+    }
+
+    return false;
+}
+
+void DTMF_CompileTemplates(void)
+{
+    char String[20];
+    uint8_t i;
+
+    gDTMF_GroupCode = DTMF_GetCode(gEeprom.DTMF_GROUP_CALL_CODE);
+
+    // Templates are the first Size characters, as the compare used to see them
+    memset(String, 0, sizeof(String));
+    snprintf(String, sizeof(String), "%s%c%s", gEeprom.ANI_DTMF_ID, gEeprom.DTMF_SEPARATE_CODE, gEeprom.KILL_CODE);
+    DTMF_Compile(DTMF_TEMPLATE_KILL, String, 9, 9, true);
+
+    memset(String, 0, sizeof(String));
+    snprintf(String, sizeof(String), "%s%c%s", gEeprom.ANI_DTMF_ID, gEeprom.DTMF_SEPARATE_CODE, gEeprom.REVIVE_CODE);
+    DTMF_Compile(DTMF_TEMPLATE_REVIVE, String, 9, 9, true);
+
+    DTMF_Compile(DTMF_TEMPLATE_AB, "AB", 2, 2, true);
+
+    memset(String, 0, sizeof(String));
+    snprintf(String, sizeof(String), "%s%c%s", gDTMF_String, gEeprom.DTMF_SEPARATE_CODE, "AAAAA");
+    DTMF_Compile(DTMF_TEMPLATE_CALL_OUT, String, 9, 9, false);
+
+    // Our ID and the separator, followed by the caller's ID
+    memset(String, 0, sizeof(String));
+    snprintf(String, sizeof(String), "%s%c", gEeprom.ANI_DTMF_ID, gEeprom.DTMF_SEPARATE_CODE);
+    DTMF_Compile(DTMF_TEMPLATE_CALL_IN, String, 7, 4, true);
+
+    // Catch up with the digits already received
+    for (i = 0; i < sizeof(gDTMF_Received); i++)
+    {
+        const uint8_t Code = DTMF_GetCode(gDTMF_Received[(gDTMF_WriteIndex + i) % sizeof(gDTMF_Received)]);
+        uint8_t j;
+
+        for (j = 0; j < DTMF_TEMPLATE_COUNT; j++)
+        {
+            DTMF_Advance(&gDTMF_Templates[j], Code);
+        }
+    }
+}
+
+void DTMF_Receive(uint8_t Code)
+{
+    uint8_t i;
+
+    gDTMF_Received[gDTMF_WriteIndex] = DTMF_GetCharacter(Code);
+    gDTMF_WriteIndex = (gDTMF_WriteIndex + 1) % sizeof(gDTMF_Received);
+    for (i = 0; i < DTMF_TEMPLATE_COUNT; i++)
+    {
+        DTMF_Advance(&gDTMF_Templates[i], Code);
+    }
+}
+
+void DTMF_ClearReceived(void)
+{
+    uint8_t i;
+
+    gDTMF_WriteIndex = 0;
+    memset(gDTMF_Received, 0, sizeof(gDTMF_Received));
+    for (i = 0; i < DTMF_TEMPLATE_COUNT; i++)
+    {
+        gDTMF_Templates[i].Exact = 0;
+        gDTMF_Templates[i].Group = 0;
+    }
 }
 
 DTMF_CallMode_t DTMF_CheckGroupCall(const char *pMsg, uint32_t Size)
@@ -204,8 +373,7 @@ void DTMF_Append(char Code)
 
 void DTMF_HandleRequest(void)
 {
-    char String[20];
-    uint8_t Offset;
+    bool bGroup;
 
     if (!gDTMF_RequestPending)
     {
@@ -224,66 +392,53 @@ void DTMF_HandleRequest(void)
         return;
     }
 
-    if (gDTMF_WriteIndex >= 9)
+    if (DTMF_IsMatch(DTMF_TEMPLATE_KILL, &bGroup))
     {
-        Offset = gDTMF_WriteIndex - 9;
-        sprintf(String, "%s%c%s", gEeprom.ANI_DTMF_ID, gEeprom.DTMF_SEPARATE_CODE, gEeprom.KILL_CODE);
-        if (DTMF_CompareMessage(gDTMF_Received + Offset, String, 9, true))
+        if (gEeprom.PERMIT_REMOTE_KILL)
         {
-            if (gEeprom.PERMIT_REMOTE_KILL)
-            {
-                gSetting_KILLED = true;
-                SETTINGS_SaveSettings();
-                gDTMF_ReplyState = DTMF_REPLY_AB;
+            gSetting_KILLED = true;
+            SETTINGS_SaveSettings();
+            gDTMF_ReplyState = DTMF_REPLY_AB;
 #if defined(ENABLE_FMRADIO)
-                if (gFmRadioMode)
-                {
-                    FM_TurnOff();
-                    GUI_SelectNextDisplay(DISPLAY_MAIN);
-                }
-#endif
-            }
-            else
+            if (gFmRadioMode)
             {
-                gDTMF_ReplyState = DTMF_REPLY_NONE;
+                FM_TurnOff();
+                GUI_SelectNextDisplay(DISPLAY_MAIN);
             }
-            gDTMF_CallState = DTMF_CALL_STATE_NONE;
-            gUpdateDisplay = true;
-            gUpdateStatus = true;
-            return;
+#endif
         }
-        sprintf(String, "%s%c%s", gEeprom.ANI_DTMF_ID, gEeprom.DTMF_SEPARATE_CODE, gEeprom.REVIVE_CODE);
-        if (DTMF_CompareMessage(gDTMF_Received + Offset, String, 9, true))
+        else
         {
-            gSetting_KILLED = false;
-            SETTINGS_SaveSettings();
-            gDTMF_ReplyState = DTMF_REPLY_AB;
-            gDTMF_CallState = DTMF_CALL_STATE_NONE;
-            gUpdateDisplay = true;
-            gUpdateStatus = true;
-            return;
+            gDTMF_ReplyState = DTMF_REPLY_NONE;
         }
+        gDTMF_CallState = DTMF_CALL_STATE_NONE;
+        gUpdateDisplay = true;
+        gUpdateStatus = true;
+        return;
     }
 
-    if (gDTMF_WriteIndex >= 2)
+    if (DTMF_IsMatch(DTMF_TEMPLATE_REVIVE, &bGroup))
     {
-        if (DTMF_CompareMessage(gDTMF_Received + (gDTMF_WriteIndex - 2), "AB", 2, true))
-        {
-            gDTMF_State = DTMF_STATE_TX_SUCC;
-            gUpdateDisplay = true;
-            return;
-        }
+        gSetting_KILLED = false;
+        SETTINGS_SaveSettings();
+        gDTMF_ReplyState = DTMF_REPLY_AB;
+        gDTMF_CallState = DTMF_CALL_STATE_NONE;
+        gUpdateDisplay = true;
+        gUpdateStatus = true;
+        return;
     }
 
-    if (gDTMF_CallState == DTMF_CALL_STATE_CALL_OUT && gDTMF_CallMode == DTMF_CALL_MODE_NOT_GROUP && gDTMF_WriteIndex >= 9)
+    if (DTMF_IsMatch(DTMF_TEMPLATE_AB, &bGroup))
     {
-        Offset = gDTMF_WriteIndex - 9;
-        sprintf(String, "%s%c%s", gDTMF_String, gEeprom.DTMF_SEPARATE_CODE, "AAAAA");
-        if (DTMF_CompareMessage(gDTMF_Received + Offset, String, 9, false))
-        {
-            gDTMF_State = DTMF_STATE_CALL_OUT_RSP;
-            gUpdateDisplay = true;
-        }
+        gDTMF_State = DTMF_STATE_TX_SUCC;
+        gUpdateDisplay = true;
+        return;
+    }
+
+    if (gDTMF_CallState == DTMF_CALL_STATE_CALL_OUT && gDTMF_CallMode == DTMF_CALL_MODE_NOT_GROUP && DTMF_IsMatch(DTMF_TEMPLATE_CALL_OUT, &bGroup))
+    {
+        gDTMF_State = DTMF_STATE_CALL_OUT_RSP;
+        gUpdateDisplay = true;
     }
 
     if (gSetting_KILLED || gDTMF_CallState != DTMF_CALL_STATE_NONE)
@@ -291,42 +446,44 @@ void DTMF_HandleRequest(void)
         return;
     }
 
-    if (gDTMF_WriteIndex >= 7)
+    gDTMF_IsGroupCall = false;
+    if (DTMF_IsMatch(DTMF_TEMPLATE_CALL_IN, &bGroup))
     {
-        Offset = gDTMF_WriteIndex - 7;
-        sprintf(String, "%s%c", gEeprom.ANI_DTMF_ID, gEeprom.DTMF_SEPARATE_CODE);
-        gDTMF_IsGroupCall = false;
-        if (DTMF_CompareMessage(gDTMF_Received + Offset, String, 4, true))
+        uint8_t i;
+
+        gDTMF_IsGroupCall = bGroup;
+        gDTMF_CallState = DTMF_CALL_STATE_RECEIVED;
+        // The last 7 digits: callee, separator, caller
+        for (i = 0; i < 3; i++)
         {
-            gDTMF_CallState = DTMF_CALL_STATE_RECEIVED;
-            memcpy(gDTMF_Callee, gDTMF_Received + Offset, 3);
-            memcpy(gDTMF_Caller, gDTMF_Received + Offset + 4, 3);
+            gDTMF_Callee[i] = gDTMF_Received[(gDTMF_WriteIndex + 16 - 7 + i) % 16];
+            gDTMF_Caller[i] = gDTMF_Received[(gDTMF_WriteIndex + 16 - 3 + i) % 16];
+        }
 
-            gUpdateDisplay = true;
+        gUpdateDisplay = true;
 
-            switch (gEeprom.DTMF_DECODE_RESPONSE)
-            {
-            case 3:
-                gDTMF_DecodeRing = true;
-                gDTMF_DecodeRingCountdown = 20;
-                // Fallthrough
-            case 2:
-                gDTMF_ReplyState = DTMF_REPLY_AAAAA;
-                break;
-            case 1:
-                gDTMF_DecodeRing = true;
-                gDTMF_DecodeRingCountdown = 20;
-                break;
-            default:
-                gDTMF_DecodeRing = false;
-                gDTMF_ReplyState = DTMF_REPLY_NONE;
-                break;
-            }
+        switch (gEeprom.DTMF_DECODE_RESPONSE)
+        {
+        case 3:
+            gDTMF_DecodeRing = true;
+            gDTMF_DecodeRingCountdown = 20;
+            // Fallthrough
+        case 2:
+            gDTMF_ReplyState = DTMF_REPLY_AAAAA;
+            break;
+        case 1:
+            gDTMF_DecodeRing = true;
+            gDTMF_DecodeRingCountdown = 20;
+            break;
+        default:
+            gDTMF_DecodeRing = false;
+            gDTMF_ReplyState = DTMF_REPLY_NONE;
+            break;
+        }
 
-            if (gDTMF_IsGroupCall)
-            {
-                gDTMF_ReplyState = DTMF_REPLY_NONE;
-            }
+        if (gDTMF_IsGroupCall)
+        {
+            gDTMF_ReplyState = DTMF_REPLY_NONE;
         }
     }
 }
@@ -383,21 +540,147 @@ void DTMF_Reply(void)
             Delay = 60;
         }
     }
-    SYSTEM_DelayMs(Delay);
 
-    BK4819_EnterDTMF_TX(gEeprom.DTMF_SIDE_TONE);
+    DTMF_SendString(pString, Delay, true, false);
+}
+
+// DTMF TX sequencer. The code string is sent in the background: one step
+// per countdown expiry, advanced by DTMF_TimeSlice10ms. Delays are in ms
+// (the EEPROM settings are multiples of 10).
 
-    BK4819_PlayDTMFString(
-        pString,
-        1,
-        gEeprom.DTMF_FIRST_CODE_PERSIST_TIME,
-        gEeprom.DTMF_HASH_CODE_PERSIST_TIME,
-        gEeprom.DTMF_CODE_PERSIST_TIME,
-        gEeprom.DTMF_CODE_INTERVAL_TIME);
+enum DTMF_TxState_t
+{
+    DTMF_TX_IDLE = 0,
+    DTMF_TX_PRELOAD,
+    DTMF_TX_CODE,
+    DTMF_TX_INTERVAL,
+};
 
+typedef enum DTMF_TxState_t DTMF_TxState_t;
+
+static struct
+{
+    char String[20];
+    uint8_t Index;
+    uint8_t Countdown; // 10 ms
+    DTMF_TxState_t State;
+    bool bDelayFirst;
+    bool bKeep;
+} gDTMF_Tx;
+
+static void DTMF_TxEnd(void)
+{
     // GPIO_ClearBit(&GPIOC->DATA, GPIOC_PIN_AUDIO_PATH);
     GPIO_ResetAudioPath();
 
     gEnableSpeaker = false;
-    BK4819_ExitDTMF_TX(false);
+    BK4819_ExitDTMF_TX(gDTMF_Tx.bKeep);
+    if (!gDTMF_Tx.bKeep && gCurrentVfo->SCRAMBLING_TYPE && gSetting_ScrambleEnable)
+    {
+        BK4819_EnableScramble(gCurrentVfo->SCRAMBLING_TYPE - 1U);
+    }
+
+    gDTMF_Tx.State = DTMF_TX_IDLE;
+}
+
+static void DTMF_TxCode(void)
+{
+    const char Code = gDTMF_Tx.String[gDTMF_Tx.Index];
+    uint16_t Delay;
+
+    if (Code == 0)
+    {
+        DTMF_TxEnd();
+        return;
+    }
+
+    BK4819_PlayDTMF(Code);
+    BK4819_ExitTxMute();
+    if (gDTMF_Tx.bDelayFirst && gDTMF_Tx.Index == 0)
+    {
+        Delay = gEeprom.DTMF_FIRST_CODE_PERSIST_TIME;
+    }
+    else if (Code == '*' || Code == '#')
+    {
+        Delay = gEeprom.DTMF_HASH_CODE_PERSIST_TIME;
+    }
+    else
+    {
+        Delay = gEeprom.DTMF_CODE_PERSIST_TIME;
+    }
+    gDTMF_Tx.Countdown = Delay / 10;
+    gDTMF_Tx.State = DTMF_TX_CODE;
+}
+
+static void DTMF_TxNext(void)
+{
+    // Zero length steps don't wait for the next slice
+    do
+    {
+        switch (gDTMF_Tx.State)
+        {
+        case DTMF_TX_PRELOAD:
+            BK4819_EnterDTMF_TX(gEeprom.DTMF_SIDE_TONE);
+            DTMF_TxCode();
+            break;
+
+        case DTMF_TX_CODE:
+            BK4819_EnterTxMute();
+            gDTMF_Tx.Countdown = gEeprom.DTMF_CODE_INTERVAL_TIME / 10;
+            gDTMF_Tx.State = DTMF_TX_INTERVAL;
+            break;
+
+        case DTMF_TX_INTERVAL:
+            gDTMF_Tx.Index++;
+            DTMF_TxCode();
+            break;
+
+        default:
+            break;
+        }
+    } while (gDTMF_Tx.State != DTMF_TX_IDLE && gDTMF_Tx.Countdown == 0);
+}
+
+void DTMF_SendString(const char *pString, uint16_t Preload, bool bDelayFirst, bool bKeep)
+{
+    DTMF_FinishTx();
+
+    strncpy(gDTMF_Tx.String, pString, sizeof(gDTMF_Tx.String) - 1);
+    gDTMF_Tx.String[sizeof(gDTMF_Tx.String) - 1] = 0;
+    gDTMF_Tx.Index = 0;
+    gDTMF_Tx.bDelayFirst = bDelayFirst;
+    gDTMF_Tx.bKeep = bKeep;
+    gDTMF_Tx.Countdown = Preload / 10;
+    gDTMF_Tx.State = DTMF_TX_PRELOAD;
+    if (gDTMF_Tx.Countdown == 0)
+    {
+        DTMF_TxNext();
+    }
+}
+
+bool DTMF_IsSending(void)
+{
+    return gDTMF_Tx.State != DTMF_TX_IDLE;
+}
+
+void DTMF_FinishTx(void)
+{
+    while (DTMF_IsSending())
+    {
+        SYSTEM_DelayMs(10);
+        DTMF_TimeSlice10ms();
+    }
+}
+
+void DTMF_TimeSlice10ms(void)
+{
+    if (gDTMF_Tx.State == DTMF_TX_IDLE)
+    {
+        return;
+    }
+    if (gDTMF_Tx.Countdown && --gDTMF_Tx.Countdown)
+    {
+        return;
+    }
+    DTMF_TxNext();
 }
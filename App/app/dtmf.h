@@ -78,13 +78,20 @@ extern uint8_t gDTMF_TxStopCountdown;
 
 bool DTMF_ValidateCodes(char *pCode, uint8_t Size);
 bool DTMF_GetContact(uint8_t Index, char *pContact);
+void DTMF_LoadContactIndex(void);
 bool DTMF_FindContact(const char *pContact, char *pResult);
 char DTMF_GetCharacter(uint8_t Code);
-bool DTMF_CompareMessage(const char *pDTMF, const char *pTemplate, uint8_t Size, bool bFlag);
+void DTMF_CompileTemplates(void);
+void DTMF_Receive(uint8_t Code);
+void DTMF_ClearReceived(void);
 DTMF_CallMode_t DTMF_CheckGroupCall(const char *pDTMF, uint32_t Size);
 void DTMF_Append(char Code);
 void DTMF_HandleRequest(void);
 void DTMF_Reply(void);
+void DTMF_SendString(const char *pString, uint16_t Preload, bool bDelayFirst, bool bKeep);
+bool DTMF_IsSending(void);
+void DTMF_FinishTx(void);
+void DTMF_TimeSlice10ms(void);
 
 #endif
 
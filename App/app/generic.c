@@ -155,6 +155,7 @@ void GENERIC_Key_PTT(bool bKeyPressed)
 							gDTMF_CallMode = DTMF_CALL_MODE_DTMF;
 						}
 						sprintf(gDTMF_String, "%s", gDTMF_InputBox);
+						DTMF_CompileTemplates();
 						gDTMF_PreviousIndex = gDTMF_InputIndex;
 						gDTMF_ReplyState = DTMF_REPLY_ANI;
 						gDTMF_State = DTMF_STATE_0;
@@ -14,10 +14,13 @@
  *     limitations under the License.
  */
 
+#include <stdio.h>
+#include <string.h>
 #include "app/generic.h"
 #include "app/scanner.h"
 #include "audio.h"
 #include "driver/bk4819.h"
+#include "driver/uart.h"
 #include "frequencies.h"
 #include "misc.h"
 #include "radio.h"
@@ -346,6 +349,18 @@ void SCANNER_Stop(void)
 	Previous = gRestoreMrChannel;
 	gScanState = SCAN_OFF;
 
+#if defined(ENABLE_UART)
+	{
+		char String[32];
+
+		sprintf(String, "chc %lu/%lu\r\n", (unsigned long)gChannelCacheHits, (unsigned long)gChannelCacheMisses);
+		UART_LogSend(String, strlen(String));
+	}
+#endif
+	// Counted from here to the end of the next scan
+	gChannelCacheHits = 0;
+	gChannelCacheMisses = 0;
+
 	if (!bScanKeepFrequency) {
 		if (IS_MR_CHANNEL(gNextMrChannel)) {
 			gEeprom.MrChannel[gEeprom.RX_VFO] = gRestoreMrChannel;
@@ -0,0 +1,187 @@
+/* Copyright 2025 muzkr https://github.com/muzkr
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+
+#include <string.h>
+#include "app/spectrum.h"
+#include "driver/bk4819.h"
+#include "driver/systick.h"
+#include "frequencies.h"
+#include "misc.h"
+#include "radio.h"
+#include "ui/ui.h"
+
+// One point per main loop pass: retune, wait for the RSSI to settle and
+// read it back. Nothing else runs on the BK4819 meanwhile (interrupts and
+// audio are off, keys don't beep), so a retune is only the frequency and an
+// RX link restart.
+// The LNA path is only switched when the sweep crosses 280 MHz.
+
+// In 10 Hz units, the span is SPECTRUM_POINTS steps
+static const uint16_t StepTable[] = { 625, 1250, 2500, 5000, 10000, 20000 };
+// In us
+static const uint16_t DwellTable[] = { 400, 800, 1200, 2500 };
+
+uint8_t gSpectrumRssi[SPECTRUM_POINTS];
+uint8_t gSpectrumPeak[SPECTRUM_POINTS];
+uint32_t gSpectrumCenter;
+
+static uint8_t gSpectrumStepIndex = 2;
+static uint8_t gSpectrumDwellIndex = 2;
+static uint8_t gSpectrumPoint;
+static uint32_t gSpectrumFrequency;
+static bool gSpectrumIsVhf;
+
+uint16_t SPECTRUM_GetStep(void)
+{
+	return StepTable[gSpectrumStepIndex];
+}
+
+static void SPECTRUM_Restart(void)
+{
+	const uint32_t HalfSpan = (SPECTRUM_POINTS / 2) * SPECTRUM_GetStep();
+	const uint32_t Lower = LowerLimitFrequencyBandTable[0];
+	const uint32_t Upper = UpperLimitFrequencyBandTable[ARRAY_SIZE(UpperLimitFrequencyBandTable) - 1];
+
+	// Keep the whole sweep inside the range the radio tunes
+	if (gSpectrumCenter < Lower + HalfSpan) {
+		gSpectrumCenter = Lower + HalfSpan;
+	} else if (gSpectrumCenter > Upper - HalfSpan) {
+		gSpectrumCenter = Upper - HalfSpan;
+	}
+
+	gSpectrumPoint = 0;
+	gSpectrumFrequency = gSpectrumCenter - HalfSpan;
+	gSpectrumIsVhf = gSpectrumFrequency < 28000000;
+	BK4819_SelectFilter(gSpectrumFrequency);
+	memset(gSpectrumRssi, 0, sizeof(gSpectrumRssi));
+	memset(gSpectrumPeak, 0, sizeof(gSpectrumPeak));
+	gUpdateDisplay = true;
+}
+
+void SPECTRUM_Start(void)
+{
+	RADIO_SelectVfos();
+	RADIO_SetupRegisters(true);
+	BK4819_WriteRegister(BK4819_REG_3F, 0);
+	BK4819_SetAF(BK4819_AF_MUTE);
+	gSpectrumCenter = gRxVfo->pRX->Frequency;
+	SPECTRUM_Restart();
+	gRequestDisplayScreen = DISPLAY_SPECTRUM;
+}
+
+void SPECTRUM_Update(void)
+{
+	uint8_t Rssi;
+
+	if (gSpectrumIsVhf != (gSpectrumFrequency < 28000000)) {
+		gSpectrumIsVhf = !gSpectrumIsVhf;
+		BK4819_SelectFilter(gSpectrumFrequency);
+	}
+	BK4819_RetuneRX(gSpectrumFrequency);
+	SYSTICK_DelayUs(DwellTable[gSpectrumDwellIndex]);
+	Rssi = BK4819_GetRSSI() >> 1;
+
+	gSpectrumRssi[gSpectrumPoint] = Rssi;
+	if (gSpectrumPeak[gSpectrumPoint] < Rssi) {
+		gSpectrumPeak[gSpectrumPoint] = Rssi;
+	}
+
+	gSpectrumPoint++;
+	gSpectrumFrequency += SPECTRUM_GetStep();
+	if (gSpectrumPoint == SPECTRUM_POINTS) {
+		gSpectrumPoint = 0;
+		gSpectrumFrequency -= SPECTRUM_POINTS * SPECTRUM_GetStep();
+		gUpdateDisplay = true;
+	}
+}
+
+static void SPECTRUM_Key_DIGITS(KEY_Code_t Key, bool bKeyPressed, bool bKeyHeld)
+{
+	if (bKeyHeld || !bKeyPressed) {
+		return;
+	}
+
+	switch (Key) {
+	case KEY_0:
+		memset(gSpectrumPeak, 0, sizeof(gSpectrumPeak));
+		gUpdateDisplay = true;
+		break;
+	case KEY_1:
+		if (gSpectrumStepIndex < ARRAY_SIZE(StepTable) - 1) {
+			gSpectrumStepIndex++;
+			SPECTRUM_Restart();
+		}
+		break;
+	case KEY_7:
+		if (gSpectrumStepIndex) {
+			gSpectrumStepIndex--;
+			SPECTRUM_Restart();
+		}
+		break;
+	case KEY_3:
+		if (gSpectrumDwellIndex < ARRAY_SIZE(DwellTable) - 1) {
+			gSpectrumDwellIndex++;
+		}
+		break;
+	case KEY_9:
+		if (gSpectrumDwellIndex) {
+			gSpectrumDwellIndex--;
+		}
+		break;
+	default:
+		break;
+	}
+}
+
+static void SPECTRUM_Key_UP_DOWN(bool bKeyPressed, int8_t Direction)
+{
+	if (!bKeyPressed) {
+		return;
+	}
+	gSpectrumCenter += Direction * (int32_t)(SPECTRUM_POINTS / 8) * SPECTRUM_GetStep();
+	SPECTRUM_Restart();
+}
+
+static void SPECTRUM_Key_EXIT(bool bKeyPressed, bool bKeyHeld)
+{
+	if (!bKeyHeld && bKeyPressed) {
+		gFlagReconfigureVfos = true;
+		gRequestDisplayScreen = DISPLAY_MAIN;
+	}
+}
+
+void SPECTRUM_ProcessKeys(KEY_Code_t Key, bool bKeyPressed, bool bKeyHeld)
+{
+	switch (Key) {
+	case KEY_0: case KEY_1: case KEY_2: case KEY_3:
+	case KEY_4: case KEY_5: case KEY_6: case KEY_7:
+	case KEY_8: case KEY_9:
+		SPECTRUM_Key_DIGITS(Key, bKeyPressed, bKeyHeld);
+		break;
+	case KEY_UP:
+		SPECTRUM_Key_UP_DOWN(bKeyPressed, 1);
+		break;
+	case KEY_DOWN:
+		SPECTRUM_Key_UP_DOWN(bKeyPressed, -1);
+		break;
+	case KEY_EXIT:
+		SPECTRUM_Key_EXIT(bKeyPressed, bKeyHeld);
+		break;
+	default:
+		break;
+	}
+}
+
@@ -0,0 +1,35 @@
+/* Copyright 2025 muzkr https://github.com/muzkr
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#ifndef APP_SPECTRUM_H
+#define APP_SPECTRUM_H
+
+#include <stdint.h>
+#include "driver/keyboard.h"
+
+#define SPECTRUM_POINTS	128U
+
+// Halved BK4819 RSSI per point, the last sweep and the peak since reset
+extern uint8_t gSpectrumRssi[SPECTRUM_POINTS];
+extern uint8_t gSpectrumPeak[SPECTRUM_POINTS];
+extern uint32_t gSpectrumCenter;
+
+uint16_t SPECTRUM_GetStep(void);
+void SPECTRUM_Start(void);
+void SPECTRUM_Update(void);
+void SPECTRUM_ProcessKeys(KEY_Code_t Key, bool bKeyPressed, bool bKeyHeld);
+
+#endif
+
@@ -19,6 +19,7 @@
 #if !defined(ENABLE_OVERLAY)
 #include "driver/device.h"
 #endif
+#include "app/dtmf.h"
 #if defined(ENABLE_FMRADIO)
 #include "app/fm.h"
 #endif
@@ -33,6 +34,7 @@
 #include "driver/board.h"
 #include "functions.h"
 #include "misc.h"
+#include "radio.h"
 #include "settings.h"
 #if defined(ENABLE_OVERLAY)
 #include "sram-overlay.h"
@@ -300,6 +302,8 @@ static void CMD_051D(const uint8_t *pBuffer)
     const CMD_051D_t *pCmd = (const CMD_051D_t *)pBuffer;
     REPLY_051D_t Reply;
     bool bReloadEeprom;
+    bool bReloadCalibration;
+    bool bReloadContacts;
     bool bIsLocked;
 
     if (pCmd->Timestamp != Timestamp)
@@ -308,6 +312,8 @@ static void CMD_051D(const uint8_t *pBuffer)
     }
 
     bReloadEeprom = false;
+    bReloadCalibration = false;
+    bReloadContacts = false;
 
 #if defined(ENABLE_FMRADIO)
     gFmRadioCountdown = 4;
@@ -337,17 +343,35 @@ static void CMD_051D(const uint8_t *pBuffer)
                     bReloadEeprom = true;
                 }
             }
+            if (Offset >= 0x1C00 && Offset < 0x1D00)
+            {
+                bReloadContacts = true;
+            }
+            if (Offset >= 0x1E00)
+            {
+                // RAM copies kept by BOARD_EEPROM_LoadCalibration()
+                bReloadCalibration = true;
+            }
 
             if ((Offset < 0x0E98 || Offset >= 0x0EA0) || !bIsInLockScreen || pCmd->bAllowPassword)
             {
                 EEPROM_WriteBuffer(Offset, &pCmd->Data[i * 8U]);
             }
         }
+        RADIO_InvalidateChannelCache(0xFF);
 
         if (bReloadEeprom)
         {
             BOARD_EEPROM_Init();
         }
+        if (bReloadCalibration)
+        {
+            BOARD_EEPROM_LoadCalibration();
+        }
+        if (bReloadContacts)
+        {
+            DTMF_LoadContactIndex();
+        }
     }
 
     SendReply(&Reply, sizeof(Reply));
@@ -14,6 +14,7 @@
  *     limitations under the License.
  */
 
+#include "app/dtmf.h"
 #if defined(ENABLE_FMRADIO)
 #include "app/fm.h"
 #endif
@@ -24,7 +25,7 @@
 #include "driver/bk4819.h"
 #include "driver/gpio.h"
 #include "driver/system.h"
-#include "driver/systick.h"
+#include "driver/voice.h"
 #include "functions.h"
 #include "misc.h"
 #include "settings.h"
@@ -178,12 +179,56 @@ volatile bool gFlagPlayQueuedVoice;
 VOICE_ID_t gAnotherVoiceID = VOICE_ID_INVALID;
 BEEP_Type_t gBeepToPlay;
 
-void AUDIO_PlayBeep(BEEP_Type_t Beep)
+// Beeps are short scripts of tone steps advanced by AUDIO_TimeSlice10ms, so
+// playing one doesn't stall the main loop. Around the script the sequencer
+// keeps the original framing: audio path and BK1080 muted while the tone
+// generator settles, and everything restored after the last step.
+
+typedef struct
+{
+    uint16_t Frequency; // Hz, 0 = silence
+    uint8_t Duration;   // 10 ms
+} BEEP_Step_t;
+
+enum BEEP_State_t
+{
+    BEEP_STATE_IDLE = 0,
+    BEEP_STATE_PREPARE,
+    BEEP_STATE_LEAD_IN,
+    BEEP_STATE_SCRIPT,
+    BEEP_STATE_TAIL,
+    BEEP_STATE_RESTORE,
+};
+
+typedef enum BEEP_State_t BEEP_State_t;
+
+static const BEEP_Step_t BeepScript1kHz[] = {
+    {1000, 6},
+};
+
+static const BEEP_Step_t BeepScriptDouble[] = {
+    {500, 6},
+    {0, 2},
+    {500, 6},
+};
+
+static const BEEP_Step_t BeepScript440Hz[] = {
+    {440, 50},
+};
+
+static struct
 {
+    const BEEP_Step_t *pScript;
+    uint8_t Length;
+    uint8_t Step;
+    uint8_t Countdown;
+    BEEP_State_t State;
+    BEEP_Type_t Pending;
     uint16_t ToneConfig;
-    uint16_t ToneFrequency;
-    uint16_t Duration;
+} gBeep;
 
+static void AUDIO_StartBeep(BEEP_Type_t Beep)
+{
     if (Beep != BEEP_500HZ_60MS_DOUBLE_BEEP && Beep != BEEP_440HZ_500MS && !gEeprom.BEEP_CONTROL)
     {
         return;
@@ -204,7 +249,25 @@ void AUDIO_PlayBeep(BEEP_Type_t Beep)
         return;
     }
 
-    ToneConfig = BK4819_ReadRegister(BK4819_REG_71);
+    switch (Beep)
+    {
+    case BEEP_1KHZ_60MS_OPTIONAL:
+        gBeep.pScript = BeepScript1kHz;
+        gBeep.Length = ARRAY_SIZE(BeepScript1kHz);
+        break;
+    case BEEP_500HZ_60MS_DOUBLE_BEEP_OPTIONAL:
+    case BEEP_500HZ_60MS_DOUBLE_BEEP:
+        gBeep.pScript = BeepScriptDouble;
+        gBeep.Length = ARRAY_SIZE(BeepScriptDouble);
+        break;
+    case BEEP_440HZ_500MS:
+    default:
+        gBeep.pScript = BeepScript440Hz;
+        gBeep.Length = ARRAY_SIZE(BeepScript440Hz);
+        break;
+    }
+
+    gBeep.ToneConfig = BK4819_ReadRegister(BK4819_REG_71);
 
     // GPIO_ClearBit(&GPIOC->DATA, GPIOC_PIN_AUDIO_PATH);
     GPIO_ResetAudioPath();
@@ -220,58 +283,17 @@ void AUDIO_PlayBeep(BEEP_Type_t Beep)
         BK1080_Mute(true);
     }
 #endif
-    SYSTEM_DelayMs(20);
-    switch (Beep)
-    {
-    case BEEP_1KHZ_60MS_OPTIONAL:
-        ToneFrequency = 1000;
-        break;
-    case BEEP_500HZ_60MS_DOUBLE_BEEP_OPTIONAL:
-    case BEEP_500HZ_60MS_DOUBLE_BEEP:
-        ToneFrequency = 500;
-        break;
-    default:
-        ToneFrequency = 440;
-        break;
-    }
-    BK4819_PlayTone(ToneFrequency, true);
-    SYSTEM_DelayMs(2);
-    // GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_AUDIO_PATH);
-    GPIO_SetAudioPath();
-    SYSTEM_DelayMs(60);
-
-    switch (Beep)
-    {
-    case BEEP_500HZ_60MS_DOUBLE_BEEP_OPTIONAL:
-    case BEEP_500HZ_60MS_DOUBLE_BEEP:
-        BK4819_ExitTxMute();
-        SYSTEM_DelayMs(60);
-        BK4819_EnterTxMute();
-        SYSTEM_DelayMs(20);
-        // Fallthrough
-    case BEEP_1KHZ_60MS_OPTIONAL:
-        BK4819_ExitTxMute();
-        Duration = 60;
-        break;
-    case BEEP_440HZ_500MS:
-    default:
-        BK4819_ExitTxMute();
-        Duration = 500;
-        break;
-    }
 
-    SYSTEM_DelayMs(Duration);
-    BK4819_EnterTxMute();
-    SYSTEM_DelayMs(20);
-    // GPIO_ClearBit(&GPIOC->DATA, GPIOC_PIN_AUDIO_PATH);
-    GPIO_ResetAudioPath();
-
-    gVoxResumeCountdown = 80;
+    gBeep.Step = 0;
+    gBeep.Countdown = 2;
+    gBeep.State = BEEP_STATE_PREPARE;
+}
 
-    SYSTEM_DelayMs(5);
+static void AUDIO_EndBeep(void)
+{
     BK4819_TurnsOffTones_TurnsOnRX();
     SYSTEM_DelayMs(5);
-    BK4819_WriteRegister(BK4819_REG_71, ToneConfig);
+    BK4819_WriteRegister(BK4819_REG_71, gBeep.ToneConfig);
     if (gEnableSpeaker)
     {
         // GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_AUDIO_PATH);
@@ -287,45 +309,139 @@ void AUDIO_PlayBeep(BEEP_Type_t Beep)
     {
         BK4819_Sleep();
     }
+
+    gBeep.State = BEEP_STATE_IDLE;
 }
 
-void AUDIO_PlayVoice(uint8_t VoiceID)
+static void AUDIO_StartStep(void)
 {
-    uint8_t i;
-
-    // GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_VOICE_0);
-    GPIO_SetOutputPin(GPIO_PIN_VOICE_0);
-    SYSTEM_DelayMs(20);
-    // GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_VOICE_0);
-    GPIO_ResetOutputPin(GPIO_PIN_VOICE_0);
-    for (i = 0; i < 8; i++)
+    const BEEP_Step_t *pStep = &gBeep.pScript[gBeep.Step];
+
+    if (pStep->Frequency == 0)
     {
-        if ((VoiceID & 0x80U) == 0)
+        BK4819_EnterTxMute();
+    }
+    else
+    {
+        if (gBeep.Step != 0 && pStep->Frequency != gBeep.pScript[gBeep.Step - 1].Frequency)
         {
-            // GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_VOICE_1);
-            GPIO_ResetOutputPin(GPIO_PIN_VOICE_1);
+            BK4819_SetToneFrequency(pStep->Frequency);
         }
-        else
+        BK4819_ExitTxMute();
+    }
+    gBeep.Countdown = pStep->Duration;
+}
+
+void AUDIO_TimeSlice10ms(void)
+{
+    if (gBeep.State == BEEP_STATE_IDLE)
+    {
+        if (gBeep.Pending != BEEP_NONE && !DTMF_IsSending())
         {
-            // GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_VOICE_1);
-            GPIO_SetOutputPin(GPIO_PIN_VOICE_1);
+            BEEP_Type_t Beep = gBeep.Pending;
+
+            gBeep.Pending = BEEP_NONE;
+            AUDIO_StartBeep(Beep);
         }
-        SYSTICK_DelayUs(1000);
-        // GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_VOICE_0);
-        GPIO_SetOutputPin(GPIO_PIN_VOICE_0);
-        SYSTICK_DelayUs(1200);
-        // GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_VOICE_0);
-        GPIO_ResetOutputPin(GPIO_PIN_VOICE_0);
-        VoiceID <<= 1;
-        SYSTICK_DelayUs(200);
+        return;
+    }
+
+    if (gBeep.Countdown && --gBeep.Countdown)
+    {
+        return;
+    }
+
+    switch (gBeep.State)
+    {
+    case BEEP_STATE_PREPARE:
+        BK4819_PlayTone(gBeep.pScript[0].Frequency, true);
+        SYSTEM_DelayMs(2);
+        // GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_AUDIO_PATH);
+        GPIO_SetAudioPath();
+        gBeep.Countdown = 6;
+        gBeep.State = BEEP_STATE_LEAD_IN;
+        break;
+
+    case BEEP_STATE_LEAD_IN:
+        gBeep.State = BEEP_STATE_SCRIPT;
+        AUDIO_StartStep();
+        break;
+
+    case BEEP_STATE_SCRIPT:
+        if (++gBeep.Step < gBeep.Length)
+        {
+            AUDIO_StartStep();
+            break;
+        }
+        BK4819_EnterTxMute();
+        gBeep.Countdown = 2;
+        gBeep.State = BEEP_STATE_TAIL;
+        break;
+
+    case BEEP_STATE_TAIL:
+        // GPIO_ClearBit(&GPIOC->DATA, GPIOC_PIN_AUDIO_PATH);
+        GPIO_ResetAudioPath();
+        gVoxResumeCountdown = 80;
+        gBeep.Countdown = 1;
+        gBeep.State = BEEP_STATE_RESTORE;
+        break;
+
+    case BEEP_STATE_RESTORE:
+    default:
+        AUDIO_EndBeep();
+        break;
+    }
+}
+
+bool AUDIO_IsBeepPlaying(void)
+{
+    return gBeep.State != BEEP_STATE_IDLE || gBeep.Pending != BEEP_NONE;
+}
+
+void AUDIO_QueueBeep(BEEP_Type_t Beep)
+{
+    // Beeps wait for a DTMF transmission, they share the tone generator
+    if (gBeep.State == BEEP_STATE_IDLE && !DTMF_IsSending())
+    {
+        AUDIO_StartBeep(Beep);
+    }
+    else
+    {
+        gBeep.Pending = Beep;
     }
 }
 
+void AUDIO_FinishBeep(void)
+{
+    DTMF_FinishTx();
+    while (AUDIO_IsBeepPlaying())
+    {
+        SYSTEM_DelayMs(10);
+        AUDIO_TimeSlice10ms();
+    }
+}
+
+void AUDIO_PlayBeep(BEEP_Type_t Beep)
+{
+    AUDIO_FinishBeep();
+    AUDIO_QueueBeep(Beep);
+    AUDIO_FinishBeep();
+}
+
+void AUDIO_PlayVoice(uint8_t VoiceID)
+{
+    // Returns while the ID is still being clocked out (VOICE_IsBusy). The
+    // clip countdown in the scheduler holds until it's done.
+    VOICE_Send(VoiceID);
+}
+
 void AUDIO_PlaySingleVoice(bool bFlag)
 {
     uint8_t VoiceID;
     uint8_t Delay;
 
+    AUDIO_FinishBeep();
+
     VoiceID = gVoiceID[0];
     if (gEeprom.VOICE_PROMPT != VOICE_PROMPT_OFF && gVoiceWriteIndex)
     {
@@ -371,6 +487,9 @@ void AUDIO_PlaySingleVoice(bool bFlag)
         }
         if (bFlag)
         {
+            while (VOICE_IsBusy())
+            {
+            }
             SYSTEM_DelayMs(Delay * 10);
             if (gCurrentFunction == FUNCTION_RECEIVE || gCurrentFunction == FUNCTION_MONITOR)
             {
@@ -472,6 +591,8 @@ void AUDIO_PlayQueuedVoice(void)
     uint8_t Delay;
     bool Skip;
 
+    AUDIO_FinishBeep();
+
     Skip = false;
     if (gVoiceReadIndex != gVoiceWriteIndex && gEeprom.VOICE_PROMPT != VOICE_PROMPT_OFF)
     {
@@ -126,6 +126,10 @@ extern volatile bool gFlagPlayQueuedVoice;
 extern VOICE_ID_t gAnotherVoiceID;
 extern BEEP_Type_t gBeepToPlay;
 
+void AUDIO_TimeSlice10ms(void);
+bool AUDIO_IsBeepPlaying(void);
+void AUDIO_QueueBeep(BEEP_Type_t Beep);
+void AUDIO_FinishBeep(void);
 void AUDIO_PlayBeep(BEEP_Type_t Beep);
 void AUDIO_PlayVoice(uint8_t VoiceID);
 void AUDIO_PlaySingleVoice(bool bFlag);
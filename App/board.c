@@ -121,10 +121,10 @@ void BOARD_EEPROM_Init(void)
     // 0E90..0E97
     EEPROM_ReadBuffer(0x0E90, Data, 8);
     gEeprom.BEEP_CONTROL = (Data[0] < 2) ? Data[0] : true;
-    gEeprom.KEY_1_SHORT_PRESS_ACTION = (Data[1] < 9) ? Data[1] : 3;
-    gEeprom.KEY_1_LONG_PRESS_ACTION = (Data[2] < 9) ? Data[2] : 8;
-    gEeprom.KEY_2_SHORT_PRESS_ACTION = (Data[3] < 9) ? Data[3] : 1;
-    gEeprom.KEY_2_LONG_PRESS_ACTION = (Data[4] < 9) ? Data[4] : 6;
+    gEeprom.KEY_1_SHORT_PRESS_ACTION = (Data[1] < 10) ? Data[1] : 3;
+    gEeprom.KEY_1_LONG_PRESS_ACTION = (Data[2] < 10) ? Data[2] : 8;
+    gEeprom.KEY_2_SHORT_PRESS_ACTION = (Data[3] < 10) ? Data[3] : 1;
+    gEeprom.KEY_2_LONG_PRESS_ACTION = (Data[4] < 10) ? Data[4] : 6;
     gEeprom.SCAN_RESUME_MODE = (Data[5] < 3) ? Data[5] : SCAN_RESUME_CO;
     gEeprom.AUTO_KEYPAD_LOCK = (Data[6] < 2) ? Data[6] : true;
     gEeprom.POWER_ON_DISPLAY_MODE = (Data[7] < 3) ? Data[7] : POWER_ON_DISPLAY_MODE_VOLTAGE;
@@ -196,6 +196,7 @@ void BOARD_EEPROM_Init(void)
     {
         memcpy(gEeprom.REVIVE_CODE, "9DCBA\0\0", 8);
     }
+    DTMF_CompileTemplates();
 
     // 0EF8..0F07
     EEPROM_ReadBuffer(0x0EF8, Data, 16);
@@ -251,6 +252,10 @@ void BOARD_EEPROM_Init(void)
 
     // 0D60..0E27
     EEPROM_ReadBuffer(0x0D60, gMR_ChannelAttributes, sizeof(gMR_ChannelAttributes));
+    RADIO_InitChannelBitmaps();
+
+    // 1C00..1CFF
+    DTMF_LoadContactIndex();
 
     // 0F30..0F3F
     EEPROM_ReadBuffer(0x0F30, gCustomAesKey, sizeof(gCustomAesKey));
@@ -270,6 +275,8 @@ void BOARD_EEPROM_Init(void)
 void BOARD_EEPROM_LoadCalibration(void)
 {
     uint8_t Mic;
+    uint8_t i;
+    uint8_t j;
 
     EEPROM_ReadBuffer(0x1EC0, gEEPROM_RSSI_CALIB[3], 8);
     memcpy(gEEPROM_RSSI_CALIB[4], gEEPROM_RSSI_CALIB[3], 8);
@@ -280,6 +287,22 @@ void BOARD_EEPROM_LoadCalibration(void)
     memcpy(gEEPROM_RSSI_CALIB[1], gEEPROM_RSSI_CALIB[0], 8);
     memcpy(gEEPROM_RSSI_CALIB[2], gEEPROM_RSSI_CALIB[0], 8);
 
+    // 1E00..1E5F and 1E60..1EBF: squelch thresholds for bands from / below
+    // 174 MHz, 6 rows of 16 indexed by squelch level (1..9)
+    for (i = 0; i < 2; i++)
+    {
+        for (j = 0; j < 6; j++)
+        {
+            EEPROM_ReadBuffer(0x1E00 + (i * 0x60) + (j * 0x10), gEEPROM_SQUELCH_CALIB[i][j], 10);
+        }
+    }
+
+    // 1ED0..1F3F: TX power, 3 bytes per output power level per band
+    for (i = 0; i < 7; i++)
+    {
+        EEPROM_ReadBuffer(0x1ED0 + (i * 0x10), gEEPROM_TXP_CALIB[i], 12);
+    }
+
     EEPROM_ReadBuffer(0x1F40, gBatteryCalibration, 12);
     if (gBatteryCalibration[0] >= 5000)
     {
@@ -339,6 +362,7 @@ void BOARD_FactoryReset(bool bIsAll)
             EEPROM_WriteBuffer(i, Template);
         }
     }
+    RADIO_InvalidateChannelCache(0xFF);
     if (bIsAll)
     {
         RADIO_InitInfo(gRxVfo, FREQ_CHANNEL_FIRST + 5, 5, 41002500);
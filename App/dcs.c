@@ -63,26 +63,82 @@ const uint16_t DCS_Options[104] = {
 	0x01DA, 0x01DC, 0x01E3, 0x01EC,
 };
 
-static uint32_t DCS_CalculateGolay(uint32_t CodeWord)
-{
-	uint32_t Word;
-	uint8_t i;
+// First code nearer to CTCSS_Options[i] than to the tone below it, ties
+// going to the lower tone. Generated by serialtool/lookup_tables.py.
+static const uint16_t CTCSS_Boundaries[50] = {
+	0x0000, 0x02AA, 0x02C3, 0x02DC,
+	0x02F6, 0x0310, 0x032C, 0x0348,
+	0x0366, 0x0385, 0x03A4, 0x03C2,
+	0x03DC, 0x03FA, 0x041E, 0x0443,
+	0x0469, 0x0491, 0x04BA, 0x04E4,
+	0x0510, 0x053E, 0x056E, 0x059E,
+	0x05D1, 0x0605, 0x062F, 0x064B,
+	0x0667, 0x0684, 0x06A1, 0x06BE,
+	0x06DC, 0x06FB, 0x071A, 0x0739,
+	0x0759, 0x077A, 0x079C, 0x07BD,
+	0x07E0, 0x0803, 0x0827, 0x0861,
+	0x08AC, 0x08E3, 0x090A, 0x094A,
+	0x099D, 0x09DB,
+};
 
-	Word = CodeWord;
-	for (i = 0; i < 12; i++) {
-		Word <<= 1;
-		if (Word & 0x1000) {
-			Word ^= 0x08EA;
-		}
-	}
-	return CodeWord | ((Word & 0x0FFE) << 11);
-}
+// Golay parity of DCS_Options[i] + 0x800, bits 12..22 of the codeword.
+// Generated by serialtool/dcs_tables.py.
+static const uint16_t DCS_Parity[104] = {
+	0x763, 0x6B7, 0x65D, 0x51F, 0x5F5, 0x0BE, 0x5B6, 0x0FD,
+	0x7CA, 0x355, 0x6F4, 0x5D1, 0x679, 0x693, 0x2E6, 0x747,
+	0x35E, 0x72B, 0x7C1, 0x5DA, 0x07B, 0x3D3, 0x339, 0x2ED,
+	0x37A, 0x2AE, 0x1EC, 0x44D, 0x4A7, 0x6BC, 0x31D, 0x05F,
+	0x18B, 0x6E9, 0x5AB, 0x68E, 0x75A, 0x7B0, 0x45B, 0x1FA,
+	0x58F, 0x565, 0x627, 0x6CD, 0x36C, 0x177, 0x5E8, 0x43C,
+	0x4D6, 0x794, 0x6AA, 0x0CF, 0x38D, 0x6C6, 0x196, 0x23E,
+	0x2D4, 0x297, 0x3A9, 0x0EB, 0x54A, 0x685, 0x2F0, 0x158,
+	0x776, 0x79C, 0x3E9, 0x4B9, 0x6C5, 0x62F, 0x7B8, 0x752,
+	0x4FA, 0x52E, 0x15B, 0x3AA, 0x27E, 0x60B, 0x6E1, 0x3C6,
+	0x2F8, 0x41B, 0x275, 0x34B, 0x0E3, 0x19E, 0x0C7, 0x5D9,
+	0x671, 0x0F5, 0x01F, 0x728, 0x7C2, 0x4C3, 0x247, 0x393,
+	0x22B, 0x0BD, 0x398, 0x1E4, 0x10E, 0x0DA, 0x14D, 0x20F,
+};
+
+// Smallest rotation of every codeword in ascending order, and the option it
+// belongs to. Every inverted codeword is a rotation of some normal one, so a
+// single lookup covers both polarities as the old rotation scan did.
+static const uint32_t DCS_Normalized[104] = {
+	0x013EC7, 0x015D6F, 0x016CBB, 0x019A3F, 0x01ABEB, 0x01E17D,
+	0x01F997, 0x023B6D, 0x0271FB, 0x029F95, 0x02B6AB, 0x02CDE9,
+	0x02E4D7, 0x02FC3D, 0x0309DF, 0x035BA3, 0x036A77, 0x03729D,
+	0x039CF3, 0x03AD27, 0x03B5CD, 0x03CE8F, 0x03D665, 0x03E7B1,
+	0x044B7B, 0x047AAF, 0x04C6BD, 0x04DE57, 0x04F769, 0x052BB5,
+	0x05335F, 0x0550F7, 0x0579C9, 0x058F4D, 0x0597A7, 0x05A673,
+	0x05BE99, 0x05C5DB, 0x05DD31, 0x05ECE5, 0x062E1F, 0x0636F5,
+	0x064DB7, 0x06555D, 0x067C63, 0x068AE7, 0x06A3D9, 0x06BB33,
+	0x06D89B, 0x06E94F, 0x06F1A5, 0x071CAD, 0x072D79, 0x073593,
+	0x074ED1, 0x07563B, 0x07916B, 0x07EA29, 0x08AB57, 0x08B3BD,
+	0x08F92B, 0x0925F7, 0x093D1D, 0x09465F, 0x095EB5, 0x09778B,
+	0x0999E5, 0x09CB99, 0x09D373, 0x09E2A7, 0x09FA4D, 0x0A38B7,
+	0x0A5B1F, 0x0A6ACB, 0x0AAD9B, 0x0ACE33, 0x0AD6D9, 0x0B233B,
+	0x0B69AD, 0x0B9F29, 0x0BCD55, 0x0BE46B, 0x0C7975, 0x0C971B,
+	0x0CA6CF, 0x0CDD8D, 0x0CF4B3, 0x0D4BC7, 0x0D532D, 0x0D947D,
+	0x0DA5A9, 0x0E4E6D, 0x0E6753, 0x0E91D7, 0x0EEA95, 0x0F3649,
+	0x126EA5, 0x12764F, 0x12A9F5, 0x12CA5D, 0x12D2B7, 0x132755,
+	0x1534EB, 0x156697,
+};
+
+static const uint8_t DCS_NormalizedOption[104] = {
+	  0,   1,   2,   3,   4,   5,  90,   6,   7,   8,   9,  10,  77,
+	 31,  18,  11, 101,  81,  12,  13,  14,  15,  89, 103,  37,  62,
+	 16,  17,  64,  19,  92,  20,  65,  61,  21,  22,  66,  23,  33,
+	 97,  32,  24,  78,  25,  51,  96,  26,  87,  27,  28,  79,  84,
+	 29,  93, 100,  30,  47,  39,  34,  46,  63,  70,  35,  80,  36,
+	 45,  91,  67,  98,  42,  76,  38,  40,  41,  43,  88,  44,  68,
+	 48,  49,  50,  69,  86,  52, 102,  53,  85,  57,  54,  55,  56,
+	 95,  58,  59,  60,  94,  71,  99,  72,  73,  74,  75,  82,  83,
+};
 
 uint32_t DCS_GetGolayCodeWord(DCS_CodeType_t CodeType, uint8_t Option)
 {
 	uint32_t Code;
 
-	Code = DCS_CalculateGolay(DCS_Options[Option] + 0x800U);
+	Code = 0x800U | DCS_Options[Option] | ((uint32_t)DCS_Parity[Option] << 12);
 	if (CodeType == CODE_TYPE_REVERSE_DIGITAL) {
 		Code ^= 0x7FFFFF;
 	}
@@ -92,27 +148,37 @@ uint32_t DCS_GetGolayCodeWord(DCS_CodeType_t CodeType, uint8_t Option)
 
 uint8_t DCS_GetCdcssCode(uint32_t Code)
 {
+	uint32_t Smallest;
+	uint8_t Low;
+	uint8_t High;
 	uint8_t i;
 
-	for (i = 0; i < 23; i++) {
-		uint32_t Shift;
-
-		if (((Code >> 9) & 0x7U) == 4) {
-			uint8_t j;
+	if (Code & 0x800000U) {
+		// Bit 23 is folded into bit 22 by the first rotation, as before.
+		Code = (Code >> 1) | ((Code & 1U) << 22);
+	}
 
-			for (j = 0; j < ARRAY_SIZE(DCS_Options); j++) {
-				if (DCS_Options[j] == (Code & 0x1FF)) {
-					if (DCS_GetGolayCodeWord(2, j) == Code) {
-						return j;
-					}
-				}
-			}
+	Smallest = Code;
+	for (i = 0; i < 22; i++) {
+		Code = (Code >> 1) | ((Code & 1U) << 22);
+		if (Code < Smallest) {
+			Smallest = Code;
 		}
-		Shift = Code >> 1;
-		if (Code & 1U) {
-			Shift |= 0x400000U;
+	}
+
+	Low = 0;
+	High = ARRAY_SIZE(DCS_Normalized);
+	while (Low < High) {
+		const uint8_t Middle = (Low + High) / 2;
+
+		if (DCS_Normalized[Middle] < Smallest) {
+			Low = Middle + 1;
+		} else {
+			High = Middle;
 		}
-		Code = Shift;
+	}
+	if (Low < ARRAY_SIZE(DCS_Normalized) && DCS_Normalized[Low] == Smallest) {
+		return DCS_NormalizedOption[Low];
 	}
 
 	return 0xFF;
@@ -120,24 +186,31 @@ uint8_t DCS_GetCdcssCode(uint32_t Code)
 
 uint8_t DCS_GetCtcssCode(uint16_t Code)
 {
-	uint8_t i;
-	int Smallest;
-	uint8_t Result = 0xFF;
+	const uint16_t *pBoundary = CTCSS_Boundaries;
+	uint8_t Count = ARRAY_SIZE(CTCSS_Boundaries);
+	uint8_t Result;
+	int Delta;
 
-	Smallest = ARRAY_SIZE(CTCSS_Options);
-	for (i = 0; i < ARRAY_SIZE(CTCSS_Options); i++) {
-		int Delta;
+	while (Count > 1) {
+		const uint8_t Half = Count / 2;
 
-		Delta = Code - CTCSS_Options[i];
-		if (Delta < 0) {
-			Delta = -(Code - CTCSS_Options[i]);
-		}
-		if (Delta < Smallest) {
-			Smallest = Delta;
-			Result = i;
+		if (pBoundary[Half] <= Code) {
+			pBoundary += Half;
 		}
+		Count -= Half;
 	}
 
-	return Result;
+	Result = pBoundary - CTCSS_Boundaries;
+	Delta = Code - CTCSS_Options[Result];
+	if (Delta < 0) {
+		Delta = -Delta;
+	}
+	// The old nearest-tone scan started from a best distance of
+	// ARRAY_SIZE(CTCSS_Options), so tones further away never matched
+	if (Delta < (int)ARRAY_SIZE(CTCSS_Options)) {
+		return Result;
+	}
+
+	return 0xFF;
 }
 
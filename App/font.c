@@ -16,116 +16,338 @@
 
 #include "font.h"
 
-const uint8_t gFontBig[95][16] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-	{ 0x00, 0x00, 0x70, 0xF8, 0xF8, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x1B, 0x00, 0x00, 0x00 },
-	{ 0x00, 0x1E, 0x3E, 0x00, 0x00, 0x3E, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-	{ 0x40, 0xF0, 0xF0, 0x40, 0xF0, 0xF0, 0x40, 0x00, 0x04, 0x1F, 0x1F, 0x04, 0x1F, 0x1F, 0x04, 0x00 },
-	{ 0x70, 0xF8, 0x88, 0x8F, 0x8F, 0x98, 0x30, 0x00, 0x06, 0x0C, 0x08, 0x38, 0x38, 0x0F, 0x07, 0x00 },
-	{ 0x60, 0x60, 0x00, 0x00, 0x80, 0xC0, 0x60, 0x00, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x18, 0x18, 0x00 },
-	{ 0x00, 0xB0, 0xF8, 0xC8, 0x78, 0xB0, 0x80, 0x00, 0x0F, 0x1F, 0x10, 0x11, 0x0F, 0x1F, 0x10, 0x00 },
-	{ 0x00, 0x20, 0x3E, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-	{ 0x00, 0x00, 0xE0, 0xF0, 0x18, 0x08, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0F, 0x18, 0x10, 0x00, 0x00 },
-	{ 0x00, 0x00, 0x08, 0x18, 0xF0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x18, 0x0F, 0x07, 0x00, 0x00 },
-	{ 0x00, 0x40, 0xC0, 0x80, 0x80, 0xC0, 0x40, 0x00, 0x01, 0x05, 0x07, 0x03, 0x03, 0x07, 0x05, 0x01 },
-	{ 0x00, 0x00, 0x00, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x07, 0x07, 0x01, 0x01, 0x00 },
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x3C, 0x1C, 0x00, 0x00, 0x00 },
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00 },
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00 },
-	{ 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0x60, 0x00, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x00, 0x00, 0x00 },
-	{ 0xF0, 0xF8, 0x08, 0x88, 0x48, 0xF8, 0xF0, 0x00, 0x0F, 0x1F, 0x12, 0x11, 0x10, 0x1F, 0x0F, 0x00 },
-	{ 0x00, 0x20, 0x30, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x1F, 0x1F, 0x10, 0x10, 0x00 },
-	{ 0x10, 0x18, 0x08, 0x88, 0xC8, 0x78, 0x30, 0x00, 0x1C, 0x1E, 0x13, 0x11, 0x10, 0x18, 0x18, 0x00 },
-	{ 0x10, 0x18, 0x88, 0x88, 0x88, 0xF8, 0x70, 0x00, 0x08, 0x18, 0x10, 0x10, 0x10, 0x1F, 0x0F, 0x00 },
-	{ 0x80, 0xC0, 0x60, 0x30, 0xF8, 0xF8, 0x00, 0x00, 0x01, 0x01, 0x01, 0x11, 0x1F, 0x1F, 0x11, 0x00 },
-	{ 0xF8, 0xF8, 0x88, 0x88, 0x88, 0x88, 0x08, 0x00, 0x08, 0x18, 0x10, 0x10, 0x11, 0x1F, 0x0F, 0x00 },
-	{ 0xE0, 0xF0, 0x98, 0x88, 0x88, 0x80, 0x00, 0x00, 0x0F, 0x1F, 0x10, 0x10, 0x10, 0x1F, 0x0F, 0x00 },
-	{ 0x18, 0x18, 0x08, 0x08, 0x88, 0xF8, 0x78, 0x00, 0x00, 0x00, 0x1E, 0x1F, 0x01, 0x00, 0x00, 0x00 },
-	{ 0x70, 0xF8, 0x88, 0x88, 0x88, 0xF8, 0x70, 0x00, 0x0F, 0x1F, 0x10, 0x10, 0x10, 0x1F, 0x0F, 0x00 },
-	{ 0x70, 0xF8, 0x88, 0x88, 0x88, 0xF8, 0xF0, 0x00, 0x00, 0x10, 0x10, 0x10, 0x18, 0x0F, 0x07, 0x00 },
-	{ 0x00, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x00, 0x00, 0x00 },
-	{ 0x00, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1C, 0x0C, 0x00, 0x00, 0x00 },
-	{ 0x00, 0x00, 0x80, 0xC0, 0x60, 0x30, 0x10, 0x00, 0x00, 0x01, 0x03, 0x06, 0x0C, 0x18, 0x10, 0x00 },
-	{ 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00 },
-	{ 0x00, 0x10, 0x30, 0x60, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x10, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x00 },
-	{ 0x30, 0x38, 0x08, 0x88, 0xC8, 0x78, 0x30, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x1B, 0x00, 0x00, 0x00 },
-	{ 0xE0, 0xF0, 0x10, 0x90, 0x90, 0xF0, 0xE0, 0x00, 0x0F, 0x1F, 0x10, 0x17, 0x17, 0x17, 0x03, 0x00 },
-	{ 0xC0, 0xE0, 0x30, 0x18, 0x30, 0xE0, 0xC0, 0x00, 0x1F, 0x1F, 0x01, 0x01, 0x01, 0x1F, 0x1F, 0x00 },
-	{ 0x08, 0xF8, 0xF8, 0x88, 0x88, 0xF8, 0x70, 0x00, 0x10, 0x1F, 0x1F, 0x10, 0x10, 0x1F, 0x0F, 0x00 },
-	{ 0xE0, 0xF0, 0x18, 0x08, 0x08, 0x18, 0x30, 0x00, 0x07, 0x0F, 0x18, 0x10, 0x10, 0x18, 0x0C, 0x00 },
-	{ 0x08, 0xF8, 0xF8, 0x08, 0x18, 0xF0, 0xE0, 0x00, 0x10, 0x1F, 0x1F, 0x10, 0x18, 0x0F, 0x07, 0x00 },
-	{ 0x08, 0xF8, 0xF8, 0x88, 0xC8, 0x18, 0x38, 0x00, 0x10, 0x1F, 0x1F, 0x10, 0x11, 0x18, 0x1C, 0x00 },
-	{ 0x08, 0xF8, 0xF8, 0x88, 0xC8, 0x18, 0x38, 0x00, 0x10, 0x1F, 0x1F, 0x10, 0x01, 0x00, 0x00, 0x00 },
-	{ 0xE0, 0xF0, 0x18, 0x08, 0x08, 0x18, 0x30, 0x00, 0x07, 0x0F, 0x18, 0x11, 0x11, 0x0F, 0x1F, 0x00 },
-	{ 0xF8, 0xF8, 0x80, 0x80, 0x80, 0xF8, 0xF8, 0x00, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x00 },
-	{ 0x00, 0x00, 0x08, 0xF8, 0xF8, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1F, 0x1F, 0x10, 0x00, 0x00 },
-	{ 0x00, 0x00, 0x00, 0x08, 0xF8, 0xF8, 0x08, 0x00, 0x0E, 0x1E, 0x10, 0x10, 0x1F, 0x0F, 0x00, 0x00 },
-	{ 0x08, 0xF8, 0xF8, 0x80, 0xE0, 0x78, 0x18, 0x00, 0x10, 0x1F, 0x1F, 0x01, 0x03, 0x1E, 0x1C, 0x00 },
-	{ 0x08, 0xF8, 0xF8, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1F, 0x1F, 0x10, 0x10, 0x18, 0x1C, 0x00 },
-	{ 0xF8, 0xF8, 0x70, 0xE0, 0x70, 0xF8, 0xF8, 0x00, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x00 },
-	{ 0xF8, 0xF8, 0x70, 0xE0, 0xC0, 0xF8, 0xF8, 0x00, 0x1F, 0x1F, 0x00, 0x00, 0x01, 0x1F, 0x1F, 0x00 },
-	{ 0xE0, 0xF0, 0x18, 0x08, 0x18, 0xF0, 0xE0, 0x00, 0x07, 0x0F, 0x18, 0x10, 0x18, 0x0F, 0x07, 0x00 },
-	{ 0x08, 0xF8, 0xF8, 0x88, 0x88, 0xF8, 0x70, 0x00, 0x10, 0x1F, 0x1F, 0x10, 0x00, 0x00, 0x00, 0x00 },
-	{ 0xF0, 0xF8, 0x08, 0x08, 0x08, 0xF8, 0xF0, 0x00, 0x0F, 0x1F, 0x10, 0x1C, 0x78, 0x7F, 0x4F, 0x00 },
-	{ 0x08, 0xF8, 0xF8, 0x88, 0x88, 0xF8, 0x70, 0x00, 0x10, 0x1F, 0x1F, 0x00, 0x01, 0x1F, 0x1E, 0x00 },
-	{ 0x30, 0x78, 0xC8, 0x88, 0x88, 0x38, 0x30, 0x00, 0x0C, 0x1C, 0x10, 0x10, 0x11, 0x1F, 0x0E, 0x00 },
-	{ 0x00, 0x38, 0x18, 0xF8, 0xF8, 0x18, 0x38, 0x00, 0x00, 0x00, 0x10, 0x1F, 0x1F, 0x10, 0x00, 0x00 },
-	{ 0xF8, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x0F, 0x1F, 0x10, 0x10, 0x10, 0x1F, 0x0F, 0x00 },
-	{ 0xF8, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x03, 0x07, 0x0C, 0x18, 0x0C, 0x07, 0x03, 0x00 },
-	{ 0xF8, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x07, 0x1F, 0x1C, 0x07, 0x1C, 0x1F, 0x07, 0x00 },
-	{ 0x18, 0x78, 0xE0, 0x80, 0xE0, 0x78, 0x18, 0x00, 0x18, 0x1E, 0x07, 0x01, 0x07, 0x1E, 0x18, 0x00 },
-	{ 0x00, 0x78, 0xF8, 0x80, 0x80, 0xF8, 0x78, 0x00, 0x00, 0x00, 0x10, 0x1F, 0x1F, 0x10, 0x00, 0x00 },
-	{ 0x38, 0x18, 0x08, 0x88, 0xC8, 0x78, 0x38, 0x00, 0x1C, 0x1E, 0x13, 0x11, 0x10, 0x18, 0x1C, 0x00 },
-	{ 0x00, 0x00, 0xF8, 0xF8, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x10, 0x10, 0x00, 0x00 },
-	{ 0x70, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x0E, 0x1C, 0x00 },
-	{ 0x00, 0x00, 0x08, 0x08, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x1F, 0x1F, 0x00, 0x00 },
-	{ 0x10, 0x18, 0x0E, 0x07, 0x0E, 0x18, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40 },
-	{ 0x00, 0x00, 0x07, 0x0F, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-	{ 0x00, 0x40, 0x40, 0x40, 0xC0, 0x80, 0x00, 0x00, 0x0E, 0x1F, 0x11, 0x11, 0x0F, 0x1F, 0x10, 0x00 },
-	{ 0x08, 0xF8, 0xF8, 0x40, 0xC0, 0x80, 0x00, 0x00, 0x10, 0x1F, 0x0F, 0x10, 0x10, 0x1F, 0x0F, 0x00 },
-	{ 0x80, 0xC0, 0x40, 0x40, 0x40, 0xC0, 0x80, 0x00, 0x0F, 0x1F, 0x10, 0x10, 0x10, 0x18, 0x08, 0x00 },
-	{ 0x00, 0x80, 0xC0, 0x48, 0xF8, 0xF8, 0x00, 0x00, 0x0F, 0x1F, 0x10, 0x10, 0x0F, 0x1F, 0x10, 0x00 },
-	{ 0x80, 0xC0, 0x40, 0x40, 0x40, 0xC0, 0x80, 0x00, 0x0F, 0x1F, 0x11, 0x11, 0x11, 0x19, 0x09, 0x00 },
-	{ 0x80, 0xF0, 0xF8, 0x88, 0x18, 0x30, 0x00, 0x00, 0x10, 0x1F, 0x1F, 0x10, 0x00, 0x00, 0x00, 0x00 },
-	{ 0x80, 0xC0, 0x40, 0x40, 0x80, 0xC0, 0x40, 0x00, 0x4F, 0xDF, 0x90, 0x90, 0xFF, 0x7F, 0x00, 0x00 },
-	{ 0x08, 0xF8, 0xF8, 0x80, 0x40, 0xC0, 0x80, 0x00, 0x10, 0x1F, 0x1F, 0x00, 0x00, 0x1F, 0x1F, 0x00 },
-	{ 0x00, 0x00, 0x40, 0xD8, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1F, 0x1F, 0x10, 0x00, 0x00 },
-	{ 0x00, 0x00, 0x00, 0x00, 0x40, 0xD8, 0xD8, 0x00, 0x00, 0x60, 0xE0, 0x80, 0x80, 0xFF, 0x7F, 0x00 },
-	{ 0x08, 0xF8, 0xF8, 0x00, 0x80, 0xC0, 0x40, 0x00, 0x10, 0x1F, 0x1F, 0x03, 0x07, 0x1C, 0x18, 0x00 },
-	{ 0x00, 0x00, 0x08, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1F, 0x1F, 0x10, 0x00, 0x00 },
-	{ 0xC0, 0xC0, 0xC0, 0x80, 0xC0, 0xC0, 0x80, 0x00, 0x1F, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x1F, 0x00 },
-	{ 0x40, 0xC0, 0x80, 0x40, 0x40, 0xC0, 0x80, 0x00, 0x00, 0x1F, 0x1F, 0x00, 0x00, 0x1F, 0x1F, 0x00 },
-	{ 0x80, 0xC0, 0x40, 0x40, 0x40, 0xC0, 0x80, 0x00, 0x0F, 0x1F, 0x10, 0x10, 0x10, 0x1F, 0x0F, 0x00 },
-	{ 0x40, 0xC0, 0x80, 0x40, 0x40, 0xC0, 0x80, 0x00, 0x80, 0xFF, 0xFF, 0x90, 0x10, 0x1F, 0x0F, 0x00 },
-	{ 0x80, 0xC0, 0x40, 0x40, 0x80, 0xC0, 0x40, 0x00, 0x0F, 0x1F, 0x10, 0x90, 0xFF, 0xFF, 0x80, 0x00 },
-	{ 0x40, 0xC0, 0x80, 0xC0, 0x40, 0xC0, 0x80, 0x00, 0x10, 0x1F, 0x1F, 0x10, 0x00, 0x00, 0x01, 0x00 },
-	{ 0x80, 0xC0, 0x40, 0x40, 0x40, 0xC0, 0x80, 0x00, 0x08, 0x19, 0x13, 0x12, 0x16, 0x1C, 0x08, 0x00 },
-	{ 0x40, 0x40, 0xF0, 0xF8, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x1F, 0x10, 0x18, 0x08, 0x00 },
-	{ 0xC0, 0xC0, 0x00, 0x00, 0xC0, 0xC0, 0x00, 0x00, 0x0F, 0x1F, 0x10, 0x10, 0x0F, 0x1F, 0x10, 0x00 },
-	{ 0x00, 0xC0, 0xC0, 0x00, 0x00, 0xC0, 0xC0, 0x00, 0x00, 0x07, 0x0F, 0x18, 0x18, 0x0F, 0x07, 0x00 },
-	{ 0xC0, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0x00, 0x0F, 0x1F, 0x18, 0x0E, 0x18, 0x1F, 0x0F, 0x00 },
-	{ 0x40, 0xC0, 0x80, 0x00, 0x80, 0xC0, 0x40, 0x00, 0x10, 0x18, 0x0F, 0x07, 0x0F, 0x18, 0x10, 0x00 },
-	{ 0xC0, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0x00, 0x8F, 0x9F, 0x90, 0x90, 0xD0, 0x7F, 0x3F, 0x00 },
-	{ 0xC0, 0xC0, 0x40, 0x40, 0xC0, 0xC0, 0x40, 0x00, 0x18, 0x1C, 0x16, 0x13, 0x11, 0x18, 0x18, 0x00 },
-	{ 0x00, 0x80, 0x80, 0xF0, 0x78, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x1F, 0x10, 0x10, 0x00 },
-	{ 0x00, 0x00, 0x00, 0x78, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x00, 0x00, 0x00 },
-	{ 0x00, 0x08, 0x08, 0x78, 0xF0, 0x80, 0x80, 0x00, 0x00, 0x10, 0x10, 0x1F, 0x0F, 0x00, 0x00, 0x00 },
-	{ 0x10, 0x18, 0x08, 0x18, 0x10, 0x18, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+// The big fonts are stored as indices into gFontColumns, one byte per glyph
+// column. Generated by serialtool/font_tables.py, which can also turn them
+// back into plain bitmaps for editing.
+
+const uint8_t gFontColumns[215][2] = {
+	{ 0x00, 0x00 },
+	{ 0x70, 0x00 },
+	{ 0xF8, 0x1B },
+	{ 0x1E, 0x00 },
+	{ 0x3E, 0x00 },
+	{ 0x40, 0x04 },
+	{ 0xF0, 0x1F },
+	{ 0x70, 0x06 },
+	{ 0xF8, 0x0C },
+	{ 0x88, 0x08 },
+	{ 0x8F, 0x38 },
+	{ 0x98, 0x0F },
+	{ 0x30, 0x07 },
+	{ 0x60, 0x18 },
+	{ 0x60, 0x0C },
+	{ 0x00, 0x06 },
+	{ 0x00, 0x03 },
+	{ 0x80, 0x01 },
+	{ 0xC0, 0x18 },
+	{ 0x00, 0x0F },
+	{ 0xB0, 0x1F },
+	{ 0xF8, 0x10 },
+	{ 0xC8, 0x11 },
+	{ 0x78, 0x0F },
+	{ 0x80, 0x10 },
+	{ 0x20, 0x00 },
+	{ 0xE0, 0x07 },
+	{ 0xF0, 0x0F },
+	{ 0x18, 0x18 },
+	{ 0x08, 0x10 },
+	{ 0x00, 0x01 },
+	{ 0x40, 0x05 },
+	{ 0xC0, 0x07 },
+	{ 0x80, 0x03 },
+	{ 0x00, 0x20 },
+	{ 0x00, 0x3C },
+	{ 0x00, 0x1C },
+	{ 0x00, 0x18 },
+	{ 0x00, 0x0C },
+	{ 0xC0, 0x00 },
+	{ 0x60, 0x00 },
+	{ 0xF8, 0x1F },
+	{ 0x08, 0x12 },
+	{ 0x88, 0x11 },
+	{ 0x48, 0x10 },
+	{ 0x20, 0x10 },
+	{ 0x30, 0x10 },
+	{ 0x00, 0x10 },
+	{ 0x10, 0x1C },
+	{ 0x18, 0x1E },
+	{ 0x08, 0x13 },
+	{ 0xC8, 0x10 },
+	{ 0x78, 0x18 },
+	{ 0x30, 0x18 },
+	{ 0x10, 0x08 },
+	{ 0x88, 0x10 },
+	{ 0x70, 0x0F },
+	{ 0xC0, 0x01 },
+	{ 0x60, 0x01 },
+	{ 0x30, 0x11 },
+	{ 0x00, 0x11 },
+	{ 0xF8, 0x08 },
+	{ 0xF8, 0x18 },
+	{ 0x88, 0x1F },
+	{ 0x08, 0x0F },
+	{ 0xE0, 0x0F },
+	{ 0x98, 0x10 },
+	{ 0x80, 0x1F },
+	{ 0x18, 0x00 },
+	{ 0x08, 0x1E },
+	{ 0x08, 0x1F },
+	{ 0x88, 0x01 },
+	{ 0xF8, 0x00 },
+	{ 0x78, 0x00 },
+	{ 0x88, 0x18 },
+	{ 0xF8, 0x0F },
+	{ 0xF0, 0x07 },
+	{ 0x60, 0x1C },
+	{ 0xC0, 0x06 },
+	{ 0x10, 0x10 },
+	{ 0x80, 0x04 },
+	{ 0x30, 0x00 },
+	{ 0x38, 0x00 },
+	{ 0x08, 0x00 },
+	{ 0x88, 0x1B },
+	{ 0xC8, 0x1B },
+	{ 0x90, 0x17 },
+	{ 0xF0, 0x17 },
+	{ 0xE0, 0x03 },
+	{ 0xC0, 0x1F },
+	{ 0xE0, 0x1F },
+	{ 0x30, 0x01 },
+	{ 0x18, 0x01 },
+	{ 0x30, 0x0C },
+	{ 0x38, 0x1C },
+	{ 0xC8, 0x01 },
+	{ 0x08, 0x11 },
+	{ 0x18, 0x0F },
+	{ 0x30, 0x1F },
+	{ 0x80, 0x00 },
+	{ 0x00, 0x0E },
+	{ 0x00, 0x1E },
+	{ 0x78, 0x1E },
+	{ 0x18, 0x1C },
+	{ 0xE0, 0x00 },
+	{ 0x88, 0x00 },
+	{ 0x08, 0x1C },
+	{ 0x08, 0x78 },
+	{ 0xF8, 0x7F },
+	{ 0xF0, 0x4F },
+	{ 0x70, 0x1E },
+	{ 0x78, 0x1C },
+	{ 0x38, 0x1F },
+	{ 0x30, 0x0E },
+	{ 0x18, 0x10 },
+	{ 0xF8, 0x03 },
+	{ 0xF8, 0x07 },
+	{ 0x00, 0x07 },
+	{ 0x10, 0x00 },
+	{ 0x0E, 0x00 },
+	{ 0x07, 0x00 },
+	{ 0x00, 0x40 },
+	{ 0x0F, 0x00 },
+	{ 0x40, 0x1F },
+	{ 0x40, 0x11 },
+	{ 0xC0, 0x0F },
+	{ 0x40, 0x10 },
+	{ 0xC0, 0x10 },
+	{ 0x80, 0x0F },
+	{ 0x80, 0x08 },
+	{ 0xC0, 0x19 },
+	{ 0x80, 0x09 },
+	{ 0x80, 0x4F },
+	{ 0xC0, 0xDF },
+	{ 0x40, 0x90 },
+	{ 0x80, 0xFF },
+	{ 0xC0, 0x7F },
+	{ 0x40, 0x00 },
+	{ 0xD8, 0x1F },
+	{ 0x00, 0x60 },
+	{ 0x00, 0xE0 },
+	{ 0x00, 0x80 },
+	{ 0x40, 0x80 },
+	{ 0xD8, 0xFF },
+	{ 0xD8, 0x7F },
+	{ 0x80, 0x07 },
+	{ 0xC0, 0x1C },
+	{ 0x40, 0x18 },
+	{ 0xC0, 0xFF },
+	{ 0x40, 0x13 },
+	{ 0x40, 0x12 },
+	{ 0x40, 0x16 },
+	{ 0x00, 0x08 },
+	{ 0xC0, 0x8F },
+	{ 0xC0, 0x9F },
+	{ 0x00, 0x90 },
+	{ 0x00, 0xD0 },
+	{ 0xC0, 0x3F },
+	{ 0xC0, 0x11 },
+	{ 0x78, 0x1F },
+	{ 0xF8, 0x3F },
+	{ 0x3C, 0x78 },
+	{ 0x0C, 0x60 },
+	{ 0x1C, 0x70 },
+	{ 0xFC, 0x7F },
+	{ 0x10, 0x70 },
+	{ 0x38, 0x78 },
+	{ 0x38, 0x7C },
+	{ 0x1C, 0x7C },
+	{ 0x0C, 0x6E },
+	{ 0x0C, 0x66 },
+	{ 0x0C, 0x67 },
+	{ 0xFC, 0x63 },
+	{ 0xF8, 0x61 },
+	{ 0xF0, 0x60 },
+	{ 0x10, 0x30 },
+	{ 0x18, 0x30 },
+	{ 0x9C, 0x71 },
+	{ 0x8C, 0x61 },
+	{ 0xCC, 0x71 },
+	{ 0x00, 0x1F },
+	{ 0xE0, 0x18 },
+	{ 0x70, 0x18 },
+	{ 0x38, 0x18 },
+	{ 0xFC, 0x18 },
+	{ 0xFC, 0x30 },
+	{ 0xCC, 0x70 },
+	{ 0xCC, 0x60 },
+	{ 0xCC, 0x7B },
+	{ 0x8C, 0x3F },
+	{ 0x0C, 0x1F },
+	{ 0x38, 0x73 },
+	{ 0x9C, 0x61 },
+	{ 0x8C, 0x73 },
+	{ 0x9C, 0x33 },
+	{ 0x38, 0x3F },
+	{ 0x30, 0x1E },
+	{ 0x0C, 0x00 },
+	{ 0x0C, 0x40 },
+	{ 0x0C, 0x78 },
+	{ 0x0C, 0x7C },
+	{ 0x8C, 0x07 },
+	{ 0xEC, 0x03 },
+	{ 0xFC, 0x00 },
+	{ 0x3C, 0x00 },
+	{ 0x1C, 0x00 },
+	{ 0x78, 0x3F },
+	{ 0xDC, 0x73 },
+	{ 0xF0, 0x11 },
+	{ 0xF8, 0x33 },
+	{ 0xB8, 0x77 },
+	{ 0x1C, 0x67 },
+	{ 0x0C, 0x76 },
+	{ 0x1C, 0x33 },
+	{ 0xB8, 0x3F },
+};
+
+const uint8_t gFontBig[95][8] = {
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // ' '
+	{ 0x00, 0x00, 0x01, 0x02, 0x02, 0x01, 0x00, 0x00 }, // '!'
+	{ 0x00, 0x03, 0x04, 0x00, 0x00, 0x04, 0x03, 0x00 }, // '"'
+	{ 0x05, 0x06, 0x06, 0x05, 0x06, 0x06, 0x05, 0x00 }, // '#'
+	{ 0x07, 0x08, 0x09, 0x0A, 0x0A, 0x0B, 0x0C, 0x00 }, // '$'
+	{ 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x0D, 0x00 }, // '%'
+	{ 0x13, 0x14, 0x15, 0x16, 0x17, 0x14, 0x18, 0x00 }, // '&'
+	{ 0x00, 0x19, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00 }, // '\''
+	{ 0x00, 0x00, 0x1A, 0x1B, 0x1C, 0x1D, 0x00, 0x00 }, // '('
+	{ 0x00, 0x00, 0x1D, 0x1C, 0x1B, 0x1A, 0x00, 0x00 }, // ')'
+	{ 0x1E, 0x1F, 0x20, 0x21, 0x21, 0x20, 0x1F, 0x1E }, // '*'
+	{ 0x00, 0x1E, 0x1E, 0x20, 0x20, 0x1E, 0x1E, 0x00 }, // '+'
+	{ 0x00, 0x00, 0x22, 0x23, 0x24, 0x00, 0x00, 0x00 }, // ','
+	{ 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x00 }, // '-'
+	{ 0x00, 0x00, 0x00, 0x25, 0x25, 0x00, 0x00, 0x00 }, // '.'
+	{ 0x25, 0x26, 0x0F, 0x10, 0x11, 0x27, 0x28, 0x00 }, // '/'
+	{ 0x1B, 0x29, 0x2A, 0x2B, 0x2C, 0x29, 0x1B, 0x00 }, // '0'
+	{ 0x00, 0x2D, 0x2E, 0x29, 0x29, 0x2F, 0x2F, 0x00 }, // '1'
+	{ 0x30, 0x31, 0x32, 0x2B, 0x33, 0x34, 0x35, 0x00 }, // '2'
+	{ 0x36, 0x1C, 0x37, 0x37, 0x37, 0x29, 0x38, 0x00 }, // '3'
+	{ 0x11, 0x39, 0x3A, 0x3B, 0x29, 0x29, 0x3C, 0x00 }, // '4'
+	{ 0x3D, 0x3E, 0x37, 0x37, 0x2B, 0x3F, 0x40, 0x00 }, // '5'
+	{ 0x41, 0x06, 0x42, 0x37, 0x37, 0x43, 0x13, 0x00 }, // '6'
+	{ 0x44, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x00 }, // '7'
+	{ 0x38, 0x29, 0x37, 0x37, 0x37, 0x29, 0x38, 0x00 }, // '8'
+	{ 0x01, 0x15, 0x37, 0x37, 0x4A, 0x4B, 0x4C, 0x00 }, // '9'
+	{ 0x00, 0x00, 0x00, 0x0E, 0x0E, 0x00, 0x00, 0x00 }, // ':'
+	{ 0x00, 0x00, 0x2F, 0x4D, 0x0E, 0x00, 0x00, 0x00 }, // ';'
+	{ 0x00, 0x1E, 0x21, 0x4E, 0x0E, 0x35, 0x4F, 0x00 }, // '<'
+	{ 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x00 }, // '='
+	{ 0x00, 0x4F, 0x35, 0x0E, 0x4E, 0x21, 0x1E, 0x00 }, // '>'
+	{ 0x51, 0x52, 0x53, 0x54, 0x55, 0x49, 0x51, 0x00 }, // '?'
+	{ 0x41, 0x06, 0x4F, 0x56, 0x56, 0x57, 0x58, 0x00 }, // '@'
+	{ 0x59, 0x5A, 0x5B, 0x5C, 0x5B, 0x5A, 0x59, 0x00 }, // 'A'
+	{ 0x1D, 0x29, 0x29, 0x37, 0x37, 0x29, 0x38, 0x00 }, // 'B'
+	{ 0x1A, 0x1B, 0x1C, 0x1D, 0x1D, 0x1C, 0x5D, 0x00 }, // 'C'
+	{ 0x1D, 0x29, 0x29, 0x1D, 0x1C, 0x1B, 0x1A, 0x00 }, // 'D'
+	{ 0x1D, 0x29, 0x29, 0x37, 0x16, 0x1C, 0x5E, 0x00 }, // 'E'
+	{ 0x1D, 0x29, 0x29, 0x37, 0x5F, 0x44, 0x52, 0x00 }, // 'F'
+	{ 0x1A, 0x1B, 0x1C, 0x60, 0x60, 0x61, 0x62, 0x00 }, // 'G'
+	{ 0x29, 0x29, 0x63, 0x63, 0x63, 0x29, 0x29, 0x00 }, // 'H'
+	{ 0x00, 0x00, 0x1D, 0x29, 0x29, 0x1D, 0x00, 0x00 }, // 'I'
+	{ 0x64, 0x65, 0x2F, 0x1D, 0x29, 0x4B, 0x53, 0x00 }, // 'J'
+	{ 0x1D, 0x29, 0x29, 0x11, 0x58, 0x66, 0x67, 0x00 }, // 'K'
+	{ 0x1D, 0x29, 0x29, 0x1D, 0x2F, 0x25, 0x24, 0x00 }, // 'L'
+	{ 0x29, 0x29, 0x01, 0x68, 0x01, 0x29, 0x29, 0x00 }, // 'M'
+	{ 0x29, 0x29, 0x01, 0x68, 0x39, 0x29, 0x29, 0x00 }, // 'N'
+	{ 0x1A, 0x1B, 0x1C, 0x1D, 0x1C, 0x1B, 0x1A, 0x00 }, // 'O'
+	{ 0x1D, 0x29, 0x29, 0x37, 0x69, 0x48, 0x01, 0x00 }, // 'P'
+	{ 0x1B, 0x29, 0x1D, 0x6A, 0x6B, 0x6C, 0x6D, 0x00 }, // 'Q'
+	{ 0x1D, 0x29, 0x29, 0x69, 0x47, 0x29, 0x6E, 0x00 }, // 'R'
+	{ 0x5D, 0x6F, 0x33, 0x37, 0x2B, 0x70, 0x71, 0x00 }, // 'S'
+	{ 0x00, 0x52, 0x72, 0x29, 0x29, 0x72, 0x52, 0x00 }, // 'T'
+	{ 0x4B, 0x29, 0x2F, 0x2F, 0x2F, 0x29, 0x4B, 0x00 }, // 'U'
+	{ 0x73, 0x74, 0x26, 0x25, 0x26, 0x74, 0x73, 0x00 }, // 'V'
+	{ 0x74, 0x29, 0x24, 0x75, 0x24, 0x29, 0x74, 0x00 }, // 'W'
+	{ 0x1C, 0x66, 0x1A, 0x11, 0x1A, 0x66, 0x1C, 0x00 }, // 'X'
+	{ 0x00, 0x49, 0x15, 0x43, 0x43, 0x15, 0x49, 0x00 }, // 'Y'
+	{ 0x5E, 0x31, 0x32, 0x2B, 0x33, 0x34, 0x5E, 0x00 }, // 'Z'
+	{ 0x00, 0x00, 0x29, 0x29, 0x1D, 0x1D, 0x00, 0x00 }, // '['
+	{ 0x01, 0x68, 0x39, 0x21, 0x75, 0x64, 0x24, 0x00 }, // '\\'
+	{ 0x00, 0x00, 0x1D, 0x1D, 0x29, 0x29, 0x00, 0x00 }, // ']'
+	{ 0x76, 0x44, 0x77, 0x78, 0x77, 0x44, 0x76, 0x00 }, // '^'
+	{ 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79 }, // '_'
+	{ 0x00, 0x00, 0x78, 0x7A, 0x53, 0x00, 0x00, 0x00 }, // '`'
+	{ 0x64, 0x7B, 0x7C, 0x7C, 0x7D, 0x43, 0x2F, 0x00 }, // 'a'
+	{ 0x1D, 0x29, 0x4B, 0x7E, 0x7F, 0x43, 0x13, 0x00 }, // 'b'
+	{ 0x80, 0x59, 0x7E, 0x7E, 0x7E, 0x12, 0x81, 0x00 }, // 'c'
+	{ 0x13, 0x43, 0x7F, 0x2C, 0x4B, 0x29, 0x2F, 0x00 }, // 'd'
+	{ 0x80, 0x59, 0x7C, 0x7C, 0x7C, 0x82, 0x83, 0x00 }, // 'e'
+	{ 0x18, 0x06, 0x29, 0x37, 0x44, 0x51, 0x00, 0x00 }, // 'f'
+	{ 0x84, 0x85, 0x86, 0x86, 0x87, 0x88, 0x89, 0x00 }, // 'g'
+	{ 0x1D, 0x29, 0x29, 0x63, 0x89, 0x59, 0x43, 0x00 }, // 'h'
+	{ 0x00, 0x00, 0x7E, 0x8A, 0x8A, 0x2F, 0x00, 0x00 }, // 'i'
+	{ 0x00, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x90, 0x00 }, // 'j'
+	{ 0x1D, 0x29, 0x29, 0x10, 0x91, 0x92, 0x93, 0x00 }, // 'k'
+	{ 0x00, 0x00, 0x1D, 0x29, 0x29, 0x2F, 0x00, 0x00 }, // 'l'
+	{ 0x59, 0x59, 0x27, 0x43, 0x27, 0x59, 0x43, 0x00 }, // 'm'
+	{ 0x89, 0x59, 0x43, 0x89, 0x89, 0x59, 0x43, 0x00 }, // 'n'
+	{ 0x80, 0x59, 0x7E, 0x7E, 0x7E, 0x59, 0x80, 0x00 }, // 'o'
+	{ 0x8E, 0x94, 0x87, 0x86, 0x7E, 0x59, 0x80, 0x00 }, // 'p'
+	{ 0x80, 0x59, 0x7E, 0x86, 0x87, 0x94, 0x8E, 0x00 }, // 'q'
+	{ 0x7E, 0x59, 0x43, 0x7F, 0x89, 0x27, 0x11, 0x00 }, // 'r'
+	{ 0x81, 0x82, 0x95, 0x96, 0x97, 0x92, 0x81, 0x00 }, // 's'
+	{ 0x89, 0x89, 0x1B, 0x29, 0x7E, 0x93, 0x98, 0x00 }, // 't'
+	{ 0x7D, 0x59, 0x2F, 0x2F, 0x7D, 0x59, 0x2F, 0x00 }, // 'u'
+	{ 0x00, 0x20, 0x7D, 0x25, 0x25, 0x7D, 0x20, 0x00 }, // 'v'
+	{ 0x7D, 0x59, 0x25, 0x64, 0x25, 0x59, 0x7D, 0x00 }, // 'w'
+	{ 0x7E, 0x12, 0x80, 0x75, 0x80, 0x12, 0x7E, 0x00 }, // 'x'
+	{ 0x99, 0x9A, 0x9B, 0x9B, 0x9C, 0x88, 0x9D, 0x00 }, // 'y'
+	{ 0x12, 0x92, 0x97, 0x95, 0x9E, 0x12, 0x93, 0x00 }, // 'z'
+	{ 0x00, 0x63, 0x63, 0x1B, 0x9F, 0x1D, 0x1D, 0x00 }, // '{'
+	{ 0x00, 0x00, 0x00, 0x9F, 0x9F, 0x00, 0x00, 0x00 }, // '|'
+	{ 0x00, 0x1D, 0x1D, 0x9F, 0x1B, 0x63, 0x63, 0x00 }, // '}'
+	{ 0x76, 0x44, 0x53, 0x44, 0x76, 0x44, 0x53, 0x00 }, // '~'
 };
 
-const uint8_t gFontBigDigits[11][26] = {
-	{ 0x00, 0xC0, 0xF0, 0xF8, 0x3C, 0x0C, 0x0C, 0x0C, 0x0C, 0x1C, 0xF8, 0xF0, 0xE0, 0x00, 0x07, 0x1F, 0x3F, 0x78, 0x60, 0x60, 0x60, 0x60, 0x70, 0x3F, 0x1F, 0x0F },
-	{ 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0xFC, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00 },
-	{ 0x00, 0x10, 0x38, 0x38, 0x1C, 0x0C, 0x0C, 0x0C, 0x0C, 0xFC, 0xF8, 0xF0, 0x00, 0x00, 0x70, 0x78, 0x7C, 0x7C, 0x6E, 0x66, 0x67, 0x67, 0x63, 0x61, 0x60, 0x00 },
-	{ 0x00, 0x10, 0x18, 0x18, 0x9C, 0x8C, 0x8C, 0x8C, 0x8C, 0xCC, 0xF8, 0xF8, 0x70, 0x00, 0x30, 0x30, 0x30, 0x71, 0x61, 0x61, 0x61, 0x61, 0x71, 0x3F, 0x3F, 0x1E },
-	{ 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0x70, 0x38, 0xFC, 0xFC, 0xFC, 0x00, 0x00, 0x1C, 0x1E, 0x1F, 0x1F, 0x19, 0x18, 0x18, 0x18, 0x7F, 0x7F, 0x7F, 0x18 },
-	{ 0x00, 0x00, 0xFC, 0xFC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x8C, 0x0C, 0x00, 0x00, 0x18, 0x30, 0x70, 0x60, 0x60, 0x60, 0x60, 0x71, 0x7B, 0x3F, 0x1F },
-	{ 0x00, 0xC0, 0xF0, 0xF8, 0x38, 0x9C, 0x8C, 0x8C, 0x8C, 0x8C, 0x9C, 0x38, 0x30, 0x00, 0x0F, 0x1F, 0x3F, 0x73, 0x61, 0x61, 0x61, 0x61, 0x73, 0x33, 0x3F, 0x1E },
-	{ 0x00, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x8C, 0xEC, 0xFC, 0x3C, 0x1C, 0x00, 0x00, 0x00, 0x40, 0x60, 0x78, 0x7C, 0x1F, 0x07, 0x03, 0x00, 0x00, 0x00 },
-	{ 0x00, 0x00, 0x78, 0xF8, 0xDC, 0x8C, 0x8C, 0x8C, 0x8C, 0xDC, 0xF8, 0x78, 0x00, 0x00, 0x1E, 0x3F, 0x3F, 0x73, 0x61, 0x61, 0x61, 0x61, 0x73, 0x3F, 0x3F, 0x1E },
-	{ 0x00, 0xF0, 0xF8, 0xB8, 0x1C, 0x0C, 0x0C, 0x0C, 0x0C, 0x1C, 0xB8, 0xF0, 0xE0, 0x00, 0x11, 0x33, 0x77, 0x67, 0x66, 0x66, 0x66, 0x76, 0x33, 0x3F, 0x1F, 0x07 },
-	{ 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00 },
+const uint8_t gFontBigDigits[11][13] = {
+	{ 0x00, 0x20, 0x06, 0xA0, 0xA1, 0xA2, 0xA2, 0xA2, 0xA2, 0xA3, 0xA0, 0x06, 0x41 }, // '0'
+	{ 0x00, 0x00, 0x00, 0x00, 0x51, 0x51, 0xA4, 0xA4, 0xA4, 0x00, 0x00, 0x00, 0x00 }, // '1'
+	{ 0x00, 0xA5, 0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xAB, 0xAB, 0xAC, 0xAD, 0xAE, 0x00 }, // '2'
+	{ 0x00, 0xAF, 0xB0, 0xB0, 0xB1, 0xB2, 0xB2, 0xB2, 0xB2, 0xB3, 0xA0, 0xA0, 0x6E }, // '3'
+	{ 0x00, 0x24, 0x65, 0xB4, 0x43, 0x82, 0xB5, 0xB6, 0xB7, 0xA4, 0xA4, 0xA4, 0x25 }, // '4'
+	{ 0x00, 0x00, 0xB8, 0xB9, 0xBA, 0xBB, 0xBB, 0xBB, 0xBB, 0xB3, 0xBC, 0xBD, 0xBE }, // '5'
+	{ 0x00, 0x7D, 0x06, 0xA0, 0xBF, 0xC0, 0xB2, 0xB2, 0xB2, 0xC1, 0xC2, 0xC3, 0xC4 }, // '6'
+	{ 0x00, 0xC5, 0xC5, 0xC6, 0xA2, 0xC7, 0xC8, 0xBE, 0xC9, 0xCA, 0xCB, 0xCC, 0xCD }, // '7'
+	{ 0x00, 0x65, 0xCE, 0xA0, 0xCF, 0xB2, 0xB2, 0xB2, 0xB2, 0xCF, 0xA0, 0xCE, 0x65 }, // '8'
+	{ 0x00, 0xD0, 0xD1, 0xD2, 0xD3, 0xAA, 0xAA, 0xAA, 0xD4, 0xD5, 0xD6, 0x06, 0x1A }, // '9'
+	{ 0x00, 0x00, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x00, 0x00 }, // '-'
 };
 
 const uint8_t gFontSmallDigits[11][7] = {
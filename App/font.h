@@ -19,8 +19,11 @@
 
 #include <stdint.h>
 
-extern const uint8_t gFontBig[95][16];
-extern const uint8_t gFontBigDigits[11][26];
+// Upper and lower byte of every distinct big font column. gFontBig and
+// gFontBigDigits hold one index into it per column.
+extern const uint8_t gFontColumns[215][2];
+extern const uint8_t gFontBig[95][8];
+extern const uint8_t gFontBigDigits[11][13];
 extern const uint8_t gFontSmallDigits[11][7];
 
 #endif
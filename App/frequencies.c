@@ -15,6 +15,7 @@
  */
 
 #include "frequencies.h"
+#include "helper/fixed.h"
 #include "misc.h"
 #include "settings.h"
 
@@ -73,35 +74,103 @@ const uint16_t StepFrequencyTable[7] = {
 	833,
 };
 
-FREQUENCY_Band_t FREQUENCY_GetBand(uint32_t Frequency)
+// Where FREQUENCY_GetBand() changes its answer, including the gaps between
+// the bands that fall back to BAND6_400MHz.
+// Generated by serialtool/lookup_tables.py.
+static const uint32_t BandStartTable[13] = {
+	       0,  5000000,  7600001, 10800000,
+	13599991, 13600000, 17399991, 17400000,
+	34999991, 35000000, 39999991, 47000000,
+	60000001,
+};
+
+static const uint8_t BandIndexTable[13] = {
+	BAND6_400MHz, BAND1_50MHz, BAND6_400MHz, BAND2_108MHz,
+	BAND6_400MHz, BAND3_136MHz, BAND6_400MHz, BAND4_174MHz,
+	BAND6_400MHz, BAND5_350MHz, BAND6_400MHz, BAND7_470MHz,
+	BAND6_400MHz,
+};
+
+// Generated by serialtool/fixed_tables.py, in StepFrequencyTable order
+static const FIXED_Reciprocal_t StepReciprocalTable[7] = {
+	{ 0x83126E98U, 39 }, // 250
+	{ 0x83126E98U, 40 }, // 500
+	{ 0xD1B71759U, 41 }, // 625
+	{ 0x83126E98U, 41 }, // 1000
+	{ 0xD1B71759U, 42 }, // 1250
+	{ 0xD1B71759U, 43 }, // 2500
+	{ 0x9D596E55U, 41 }, // 833
+};
+
+// Middle - Lower and Upper - Middle of each band
+static const FIXED_Reciprocal_t LowerSpanReciprocalTable[7] = {
+	{ 0xB2F4FC08U, 52 }, // 1500000
+	{ 0xBFBD572DU, 52 }, // 1400000
+	{ 0xBFBD572DU, 52 }, // 1400000
+	{ 0xF9B5183BU, 55 }, // 8600000
+	{ 0x8637BD06U, 52 }, // 2000000
+	{ 0x996445BEU, 53 }, // 3500000
+	{ 0x8637BD06U, 54 }, // 8000000
+};
+
+static const FIXED_Reciprocal_t UpperSpanReciprocalTable[7] = {
+	{ 0xF4084068U, 52 }, // 1100000
+	{ 0xBFBDB0EFU, 52 }, // 1399990
+	{ 0xDFB27820U, 53 }, // 2399990
+	{ 0xEE9C0C15U, 55 }, // 8999990
+	{ 0xB2F52320U, 53 }, // 2999990
+	{ 0x99646277U, 53 }, // 3499990
+	{ 0xD6BF94D6U, 54 }, // 5000000
+};
+
+static uint32_t FREQUENCY_DivideByStep(uint32_t Value, uint32_t Step)
 {
-	if (Frequency >=  5000000 && Frequency <=  7600000) {
-		return BAND1_50MHz;
-	}
-	if (Frequency >= 10800000 && Frequency <= 13599990) {
-		return BAND2_108MHz;
-	}
-	if (Frequency >= 13600000 && Frequency <= 17399990) {
-		return BAND3_136MHz;
-	}
-	if (Frequency >= 17400000 && Frequency <= 34999990) {
-		return BAND4_174MHz;
-	}
-	if (Frequency >= 35000000 && Frequency <= 39999990) {
-		return BAND5_350MHz;
+	uint8_t i;
+
+	for (i = 0; i < ARRAY_SIZE(StepFrequencyTable); i++) {
+		if (StepFrequencyTable[i] == Step) {
+			return FIXED_Divide(Value, &StepReciprocalTable[i]);
+		}
 	}
-	if (Frequency >= 40000000 && Frequency <= 46999990) {
-		return BAND6_400MHz;
+
+	return Value / Step;
+}
+
+// Interpolates Delta / Span * Txp without the signed division, rounding
+// toward zero as before
+static uint8_t FREQUENCY_Interpolate(uint8_t TxpBase, uint8_t TxpFrom, uint8_t TxpTo, uint32_t Delta, const FIXED_Reciprocal_t *pSpan)
+{
+	if (TxpTo >= TxpFrom) {
+		return TxpBase + FIXED_Divide((TxpTo - TxpFrom) * Delta, pSpan);
 	}
-	if (Frequency >= 47000000 && Frequency <= 60000000) {
-		return BAND7_470MHz;
+
+	return TxpBase - FIXED_Divide((TxpFrom - TxpTo) * Delta, pSpan);
+}
+
+FREQUENCY_Band_t FREQUENCY_GetBand(uint32_t Frequency)
+{
+	const uint32_t *pStart = BandStartTable;
+	uint8_t Count = ARRAY_SIZE(BandStartTable);
+
+	// Last start <= Frequency, in a fixed number of halvings
+	while (Count > 1) {
+		const uint8_t Half = Count / 2;
+
+		if (pStart[Half] <= Frequency) {
+			pStart += Half;
+		}
+		Count -= Half;
 	}
 
-	return BAND6_400MHz;
+	return BandIndexTable[pStart - BandStartTable];
 }
 
-uint8_t FREQUENCY_CalculateOutputPower(uint8_t TxpLow, uint8_t TxpMid, uint8_t TxpHigh, int32_t LowerLimit, int32_t Middle, int32_t UpperLimit, int32_t Frequency)
+uint8_t FREQUENCY_CalculateOutputPower(uint8_t TxpLow, uint8_t TxpMid, uint8_t TxpHigh, FREQUENCY_Band_t Band, uint32_t Frequency)
 {
+	const uint32_t LowerLimit = LowerLimitFrequencyBandTable[Band];
+	const uint32_t Middle = MiddleFrequencyBandTable[Band];
+	const uint32_t UpperLimit = UpperLimitFrequencyBandTable[Band];
+
 	if (Frequency <= LowerLimit) {
 		return TxpLow;
 	}
@@ -109,12 +178,10 @@ uint8_t FREQUENCY_CalculateOutputPower(uint8_t TxpLow, uint8_t TxpMid, uint8_t T
 		return TxpHigh;
 	}
 	if (Frequency <= Middle) {
-		TxpMid += ((TxpMid - TxpLow) * (Frequency - LowerLimit)) / (Middle - LowerLimit);
-		return TxpMid;
+		return FREQUENCY_Interpolate(TxpMid, TxpLow, TxpMid, Frequency - LowerLimit, &LowerSpanReciprocalTable[Band]);
 	}
 
-	TxpMid += ((TxpHigh - TxpMid) * (Frequency - Middle)) / (UpperLimit - Middle);
-	return TxpMid;
+	return FREQUENCY_Interpolate(TxpMid, TxpMid, TxpHigh, Frequency - Middle, &UpperSpanReciprocalTable[Band]);
 }
 
 uint32_t FREQUENCY_FloorToStep(uint32_t Upper, uint32_t Step, uint32_t Lower)
@@ -123,8 +190,8 @@ uint32_t FREQUENCY_FloorToStep(uint32_t Upper, uint32_t Step, uint32_t Lower)
 
 	if (Step == 833) {
 		const uint32_t Delta = Upper - Lower;
-		uint32_t Base = (Delta / 2500) * 2500;
-		const uint32_t Index = ((Delta - Base) % 2500) / 833;
+		uint32_t Base = FIXED_Divide(Delta, &StepReciprocalTable[5]) * 2500;
+		const uint32_t Index = FIXED_Divide(Delta - Base, &StepReciprocalTable[6]);
 
 		if (Index == 2) {
 			Base++;
@@ -133,7 +200,7 @@ uint32_t FREQUENCY_FloorToStep(uint32_t Upper, uint32_t Step, uint32_t Lower)
 		return Lower + Base + (Index * 833);
 	}
 
-	Index = (Upper - Lower) / Step;
+	Index = FREQUENCY_DivideByStep(Upper - Lower, Step);
 
 	return Lower + (Step * Index);
 }
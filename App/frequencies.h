@@ -41,7 +41,7 @@ extern const uint32_t NoaaFrequencyTable[10];
 extern const uint16_t StepFrequencyTable[7];
 
 FREQUENCY_Band_t FREQUENCY_GetBand(uint32_t Frequency);
-uint8_t FREQUENCY_CalculateOutputPower(uint8_t TxpLow, uint8_t TxpMid, uint8_t TxpHigh, int32_t LowerLimit, int32_t Middle, int32_t UpperLimit, int32_t Frequency);
+uint8_t FREQUENCY_CalculateOutputPower(uint8_t TxpLow, uint8_t TxpMid, uint8_t TxpHigh, FREQUENCY_Band_t Band, uint32_t Frequency);
 uint32_t FREQUENCY_FloorToStep(uint32_t Upper, uint32_t Step, uint32_t Lower);
 int FREQUENCY_Check(VFO_Info_t *pInfo);
 
@@ -19,6 +19,7 @@
 #if defined(ENABLE_FMRADIO)
 #include "app/fm.h"
 #endif
+#include "audio.h"
 #include "dcs.h"
 #if defined(ENABLE_FMRADIO)
 #include "driver/bk1080.h"
@@ -58,8 +59,7 @@ void FUNCTION_Init(void)
         gCurrentCodeType = CODE_TYPE_CONTINUOUS_TONE;
     }
     gDTMF_RequestPending = false;
-    gDTMF_WriteIndex = 0;
-    memset(gDTMF_Received, 0, sizeof(gDTMF_Received));
+    DTMF_ClearReceived();
     g_CxCSS_TAIL_Found = false;
     g_CDCSS_Lost = false;
     g_CTCSS_Lost = false;
@@ -80,6 +80,9 @@ void FUNCTION_Select(FUNCTION_Type_t Function)
     FUNCTION_Type_t PreviousFunction;
     bool bWasPowerSave;
 
+    AUDIO_FinishBeep();
+    DTMF_FinishTx();
+
     PreviousFunction = gCurrentFunction;
     bWasPowerSave = (PreviousFunction == FUNCTION_POWER_SAVE);
     gCurrentFunction = Function;
@@ -175,6 +178,7 @@ void FUNCTION_Select(FUNCTION_Type_t Function)
 #if defined(ENABLE_ALARM) || defined(ENABLE_TX1750)
         if (gAlarmState != ALARM_STATE_OFF)
         {
+            DTMF_FinishTx();
 #if defined(ENABLE_TX1750)
             if (gAlarmState == ALARM_STATE_TX1750)
             {
@@ -197,7 +201,8 @@ void FUNCTION_Select(FUNCTION_Type_t Function)
             break;
         }
 #endif
-        if (gCurrentVfo->SCRAMBLING_TYPE && gSetting_ScrambleEnable)
+        // A PTT-ID being sent turns the scrambler on when it ends
+        if (gCurrentVfo->SCRAMBLING_TYPE && gSetting_ScrambleEnable && !DTMF_IsSending())
         {
             BK4819_EnableScramble(gCurrentVfo->SCRAMBLING_TYPE - 1U);
         }
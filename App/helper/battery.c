@@ -16,6 +16,8 @@
 
 #include "battery.h"
 #include "driver/backlight.h"
+#include "driver/board.h"
+#include "helper/fixed.h"
 #include "misc.h"
 #include "ui/battery.h"
 #include "ui/menu.h"
@@ -24,7 +26,6 @@
 uint16_t gBatteryCalibration[6];
 uint16_t gBatteryCurrentVoltage;
 uint16_t gBatteryCurrent;
-uint16_t gBatteryVoltages[4];
 uint16_t gBatteryVoltageAverage;
 
 uint8_t gBatteryDisplayLevel;
@@ -37,6 +38,9 @@ volatile uint16_t gBatterySave;
 
 uint16_t gBatteryCheckCounter;
 
+static uint16_t gBatteryReferenceVoltage;
+static FIXED_Reciprocal_t gBatteryReferenceReciprocal;
+
 void BATTERY_GetReadings(bool bDisplayBatteryLevel)
 {
 	uint16_t Voltage;
@@ -44,7 +48,7 @@ void BATTERY_GetReadings(bool bDisplayBatteryLevel)
 
 	PreviousBatteryLevel = gBatteryDisplayLevel;
 
-	Voltage = (gBatteryVoltages[0] + gBatteryVoltages[1] + gBatteryVoltages[2] + gBatteryVoltages[3]) / 4;
+	BOARD_ADC_GetBatteryAverage(&Voltage, &gBatteryCurrent);
 
 	if (gBatteryCalibration[5] < Voltage) {
 		gBatteryDisplayLevel = 6;
@@ -62,7 +66,11 @@ void BATTERY_GetReadings(bool bDisplayBatteryLevel)
 		gBatteryDisplayLevel = 0;
 	}
 
-	gBatteryVoltageAverage = (Voltage * 760) / gBatteryCalibration[3];
+	if (gBatteryReferenceVoltage != gBatteryCalibration[3]) {
+		gBatteryReferenceVoltage = gBatteryCalibration[3];
+		gBatteryReferenceReciprocal = FIXED_MakeReciprocal(gBatteryReferenceVoltage);
+	}
+	gBatteryVoltageAverage = FIXED_Divide(Voltage * 760, &gBatteryReferenceReciprocal);
 
 	if ((gScreenToDisplay == DISPLAY_MENU) && gMenuCursor == MENU_VOL) {
 		gUpdateDisplay = true;
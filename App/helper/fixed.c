@@ -0,0 +1,43 @@
+/* Copyright 2025 muzkr https://github.com/muzkr
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+
+#include "helper/fixed.h"
+
+FIXED_Reciprocal_t FIXED_MakeReciprocal(uint32_t Divisor)
+{
+	FIXED_Reciprocal_t Reciprocal;
+	uint8_t Log2;
+
+	if (Divisor == 0) {
+		// Everything divided by 0 reads as 0
+		Reciprocal.Multiplier = 0;
+		Reciprocal.Shift = 0;
+		return Reciprocal;
+	}
+
+	Log2 = 0;
+	while ((Divisor - 1) >> Log2) {
+		Log2++;
+	}
+
+	// ceil(2^Shift / Divisor) is below 2^32 and its rounding error stays
+	// under 2^(Shift - 31), which keeps the quotient exact for 31-bit values
+	Reciprocal.Shift = 31 + Log2;
+	Reciprocal.Multiplier = (uint32_t)(((1ULL << Reciprocal.Shift) + Divisor - 1) / Divisor);
+
+	return Reciprocal;
+}
+
@@ -0,0 +1,48 @@
+/* Copyright 2025 muzkr https://github.com/muzkr
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+
+#ifndef HELPER_FIXED_H
+#define HELPER_FIXED_H
+
+#include <stdint.h>
+
+// The M0+ has no divide instruction, and every / or % turns into a call to
+// a libgcc loop of roughly 100 cycles. A division by a known divisor is a
+// multiply by its reciprocal and a shift instead, about 25 cycles.
+
+typedef struct {
+	uint32_t Multiplier;
+	uint8_t Shift;
+} FIXED_Reciprocal_t;
+
+// Value / Divisor, exact for every Value below 2^31
+static inline uint32_t FIXED_Divide(uint32_t Value, const FIXED_Reciprocal_t *pReciprocal)
+{
+	return (uint32_t)(((uint64_t)Value * pReciprocal->Multiplier) >> pReciprocal->Shift);
+}
+
+// Value / 10 for Value below 81920, without leaving 32 bits
+static inline uint32_t FIXED_Divide10(uint32_t Value)
+{
+	return (Value * 0xCCCDU) >> 19;
+}
+
+// Does one real division, so it belongs where the divisor changes, not where
+// it is used. Constant divisors get a table from serialtool/fixed_tables.py.
+FIXED_Reciprocal_t FIXED_MakeReciprocal(uint32_t Divisor);
+
+#endif
+
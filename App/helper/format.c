@@ -0,0 +1,140 @@
+/* Copyright 2025 muzkr https://github.com/muzkr
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+
+#include "helper/fixed.h"
+#include "helper/format.h"
+
+// 2^32 - 1 has ten digits, this leaves room for all three blocks of four
+#define FORMAT_MAX_DIGITS 12
+
+// The four digits of a Value below 10000
+static void FORMAT_GetBlock(char *pDigits, uint32_t Value)
+{
+	uint8_t i;
+
+	for (i = 4; i-- > 0;) {
+		const uint32_t Result = FIXED_Divide10(Value);
+
+		pDigits[i] = '0' + (Value - (Result * 10U));
+		Value = Result;
+	}
+}
+
+// Fills pDigits with FORMAT_MAX_DIGITS digits of Value, leading zeros and
+// all, and returns how many of them are significant, at least 1
+static uint8_t FORMAT_GetDigits(char *pDigits, uint32_t Value)
+{
+	// 10000 happens to be exact for all 32 bits, not just 31
+	static const FIXED_Reciprocal_t Reciprocal = { 0xD1B71759U, 45 };
+	uint32_t Middle;
+	uint32_t High;
+	uint8_t Count;
+
+	Middle = FIXED_Divide(Value, &Reciprocal);
+	Value -= Middle * 10000U;
+	High = FIXED_Divide(Middle, &Reciprocal);
+	Middle -= High * 10000U;
+
+	FORMAT_GetBlock(pDigits + 0, High);
+	FORMAT_GetBlock(pDigits + 4, Middle);
+	FORMAT_GetBlock(pDigits + 8, Value);
+
+	Count = FORMAT_MAX_DIGITS;
+	while (Count > 1 && pDigits[FORMAT_MAX_DIGITS - Count] == '0') {
+		Count--;
+	}
+
+	return Count;
+}
+
+static char *FORMAT_PowerOfTwo(char *pString, uint32_t Value, uint8_t Width, uint8_t Bits)
+{
+	static const char Characters[] = "0123456789ABCDEF";
+	const uint32_t Mask = (1U << Bits) - 1U;
+	uint8_t i;
+
+	for (i = Width; i-- > 0;) {
+		pString[i] = Characters[Value & Mask];
+		Value >>= Bits;
+	}
+	pString[Width] = 0;
+
+	return pString + Width;
+}
+
+char *FORMAT_String(char *pString, const char *pSource)
+{
+	while (*pSource) {
+		*pString++ = *pSource++;
+	}
+	*pString = 0;
+
+	return pString;
+}
+
+char *FORMAT_Decimal(char *pString, uint32_t Value, uint8_t Width)
+{
+	char Digits[FORMAT_MAX_DIGITS];
+	uint8_t Count;
+	uint8_t i;
+
+	Count = FORMAT_GetDigits(Digits, Value);
+	if (Count < Width) {
+		Count = Width;
+	}
+
+	for (i = 0; i < Count; i++) {
+		pString[i] = Digits[FORMAT_MAX_DIGITS - Count + i];
+	}
+	pString[Count] = 0;
+
+	return pString + Count;
+}
+
+char *FORMAT_Hex(char *pString, uint32_t Value, uint8_t Width)
+{
+	return FORMAT_PowerOfTwo(pString, Value, Width, 4);
+}
+
+char *FORMAT_Octal(char *pString, uint32_t Value, uint8_t Width)
+{
+	return FORMAT_PowerOfTwo(pString, Value, Width, 3);
+}
+
+char *FORMAT_Fixed(char *pString, uint32_t Value, uint8_t Decimals, uint8_t Shown)
+{
+	char Digits[FORMAT_MAX_DIGITS];
+	uint8_t Count;
+	uint8_t i;
+
+	// At least one digit in front of the point
+	Count = FORMAT_GetDigits(Digits, Value);
+	if (Count <= Decimals) {
+		Count = Decimals + 1;
+	}
+
+	for (i = 0; i < Count - Decimals; i++) {
+		*pString++ = Digits[FORMAT_MAX_DIGITS - Count + i];
+	}
+	*pString++ = '.';
+	for (i = 0; i < Shown; i++) {
+		*pString++ = Digits[FORMAT_MAX_DIGITS - Decimals + i];
+	}
+	*pString = 0;
+
+	return pString;
+}
+
@@ -0,0 +1,52 @@
+/* Copyright 2025 muzkr https://github.com/muzkr
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+
+#ifndef HELPER_FORMAT_H
+#define HELPER_FORMAT_H
+
+#include <stdint.h>
+
+// Number to text for the redraw paths, without going through sprintf() and
+// its divisions. Every function writes a NUL terminated string and returns
+// a pointer to that NUL, so pieces can be chained into one buffer:
+//
+//	p = FORMAT_String(String, "CH-");
+//	FORMAT_Decimal(p, Channel + 1, 3);
+
+// Copies pSource, like strcpy()
+char *FORMAT_String(char *pString, const char *pSource);
+
+// Value in decimal, padded with zeros to at least Width digits ("%0*u")
+char *FORMAT_Decimal(char *pString, uint32_t Value, uint8_t Width);
+
+// The low Width hex digits of Value, in upper case ("%0*X")
+char *FORMAT_Hex(char *pString, uint32_t Value, uint8_t Width);
+
+// The low Width octal digits of Value, as DCS codes are shown ("%0*o")
+char *FORMAT_Octal(char *pString, uint32_t Value, uint8_t Width);
+
+// Value / 10^Decimals with a decimal point, showing only the first Shown
+// decimals, cut off rather than rounded. 1234 with 3 and 2 is "1.23".
+char *FORMAT_Fixed(char *pString, uint32_t Value, uint8_t Decimals, uint8_t Shown);
+
+// A frequency in 10 Hz units as MHz with Shown decimals, 5 for all of them
+static inline char *FORMAT_Frequency(char *pString, uint32_t Frequency, uint8_t Shown)
+{
+	return FORMAT_Fixed(pString, Frequency, 5, Shown);
+}
+
+#endif
+
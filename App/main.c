@@ -48,10 +48,19 @@ void _putchar(char c)
 #endif
 }
 
-void Main(void)
+// printf() hands over runs of PRINTF_OUTPUT_BUFFER_SIZE characters at most
+void _putbuffer(const char *buffer, size_t count)
 {
-    uint8_t i;
+#if defined(ENABLE_UART)
+    UART_Send(buffer, count);
+#else
+    (void)buffer;
+    (void)count;
+#endif
+}
 
+void Main(void)
+{
     BOARD_Init();
 
 #if defined(ENABLE_UART)
@@ -75,11 +84,6 @@ void Main(void)
     RADIO_SelectVfos();
     RADIO_SetupRegisters(true);
 
-    for (i = 0; i < 4; i++)
-    {
-        BOARD_ADC_GetBatteryInfo(&gBatteryVoltages[i], &gBatteryCurrent);
-    }
-
     BATTERY_GetReadings(false);
     if (!gChargingWithTypeC && !gBatteryDisplayLevel)
     {
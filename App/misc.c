@@ -15,6 +15,7 @@
  */
 
 #include <string.h>
+#include "helper/fixed.h"
 #include "misc.h"
 
 const uint32_t *gUpperLimitFrequencyBandTable;
@@ -41,6 +42,8 @@ uint32_t gChallenge[4];
 uint8_t gTryCount;
 
 uint16_t gEEPROM_RSSI_CALIB[7][4];
+uint8_t gEEPROM_SQUELCH_CALIB[2][6][10];
+uint8_t gEEPROM_TXP_CALIB[7][12];
 
 uint16_t gEEPROM_1F8A;
 uint16_t gEEPROM_1F8C;
@@ -65,7 +68,6 @@ uint8_t gFoundCDCSS;
 bool gEndOfRxDetectedMaybe;
 uint8_t gVFO_RSSI_Level[2];
 uint8_t gReducedService;
-uint8_t gBatteryVoltageIndex;
 CssScanMode_t gCssScanMode;
 bool gUpdateRSSI;
 #if defined(ENABLE_ALARM) || defined(ENABLE_TX1750)
@@ -183,13 +185,27 @@ void NUMBER_Get(char *pDigits, uint32_t *pInteger)
 
 void NUMBER_ToDigits(uint32_t Value, char *pDigits)
 {
+	// 10000 happens to be exact for all 32 bits, not just 31
+	static const FIXED_Reciprocal_t Reciprocal = { 0xD1B71759U, 45 };
+	uint32_t High;
 	uint8_t i;
 
-	for (i = 0; i < 8; i++) {
-		uint32_t Result = Value / 10U;
+	// Two halves of four digits, each small enough for FIXED_Divide10()
+	High = FIXED_Divide(Value, &Reciprocal);
+	Value -= High * 10000U;
+	if (High >= 10000U) {
+		High -= FIXED_Divide(High, &Reciprocal) * 10000U;
+	}
+
+	for (i = 0; i < 4; i++) {
+		uint32_t Result = FIXED_Divide10(Value);
 
 		pDigits[7 - i] = Value - (Result * 10U);
 		Value = Result;
+
+		Result = FIXED_Divide10(High);
+		pDigits[3 - i] = High - (Result * 10U);
+		High = Result;
 	}
 }
 
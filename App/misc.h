@@ -103,6 +103,8 @@ extern uint32_t gChallenge[4];
 extern uint8_t gTryCount;
 
 extern uint16_t gEEPROM_RSSI_CALIB[7][4];
+extern uint8_t gEEPROM_SQUELCH_CALIB[2][6][10];
+extern uint8_t gEEPROM_TXP_CALIB[7][12];
 
 extern uint16_t gEEPROM_1F8A;
 extern uint16_t gEEPROM_1F8C;
@@ -128,7 +130,6 @@ extern uint8_t gFoundCDCSS;
 extern bool gEndOfRxDetectedMaybe;
 extern uint8_t gVFO_RSSI_Level[2];
 extern uint8_t gReducedService;
-extern uint8_t gBatteryVoltageIndex;
 extern CssScanMode_t gCssScanMode;
 extern bool gUpdateRSSI;
 extern AlarmState_t gAlarmState;
@@ -44,79 +44,254 @@ STEP_Setting_t gStepSetting;
 
 VfoState_t VfoState[2];
 
-bool RADIO_CheckValidChannel(uint16_t Channel, bool bCheckScanList, uint8_t VFO)
+// Packed copies of gMR_ChannelAttributes: channels with a valid band, and
+// valid channels in scan list 1 / 2
+#define MR_CHANNEL_WORDS ((MR_CHANNEL_LAST + 32U) / 32U)
+
+static uint32_t gMR_ChannelValid[MR_CHANNEL_WORDS];
+static uint32_t gMR_ChannelScanList[2][MR_CHANNEL_WORDS];
+
+static bool RADIO_TestChannelBit(const uint32_t *pMap, uint8_t Channel)
+{
+    return (pMap[Channel >> 5] >> (Channel & 31U)) & 1U;
+}
+
+static void RADIO_AssignChannelBit(uint32_t *pMap, uint8_t Channel, bool bSet)
+{
+    if (bSet)
+    {
+        pMap[Channel >> 5] |= 1U << (Channel & 31U);
+    }
+    else
+    {
+        pMap[Channel >> 5] &= ~(1U << (Channel & 31U));
+    }
+}
+
+void RADIO_UpdateChannelBitmaps(uint8_t Channel)
 {
     uint8_t Attributes;
-    uint8_t PriorityCh1;
-    uint8_t PriorityCh2;
+    bool bValid;
 
     if (!IS_MR_CHANNEL(Channel))
     {
-        return false;
+        return;
     }
 
-    // Check channel is valid
     Attributes = gMR_ChannelAttributes[Channel];
-    if ((Attributes & MR_CH_BAND_MASK) > BAND7_470MHz)
+    bValid = (Attributes & MR_CH_BAND_MASK) <= BAND7_470MHz;
+    RADIO_AssignChannelBit(gMR_ChannelValid, Channel, bValid);
+    RADIO_AssignChannelBit(gMR_ChannelScanList[0], Channel, bValid && (Attributes & MR_CH_SCANLIST1));
+    RADIO_AssignChannelBit(gMR_ChannelScanList[1], Channel, bValid && (Attributes & MR_CH_SCANLIST2));
+}
+
+void RADIO_InitChannelBitmaps(void)
+{
+    uint8_t i;
+
+    for (i = MR_CHANNEL_FIRST; i <= MR_CHANNEL_LAST; i++)
     {
-        return false;
+        RADIO_UpdateChannelBitmaps(i);
     }
+}
+
+// Raw EEPROM records of the last few memory channels used, so that going
+// back and forth between channels (scanning, up/down) stays off the I2C bus.
+// Decoding is left to RADIO_ConfigureChannel(), it depends on the VFO and on
+// settings and is cheap next to the reads.
+#define CHANNEL_CACHE_SIZE 8U
+
+typedef struct
+{
+    uint8_t Channel;
+    uint8_t Record[16]; // Channel * 16: frequency, offset, flags
+    char Name[10];      // 0x0F50 + Channel * 16
+} ChannelCacheEntry_t;
 
-    if (bCheckScanList)
+static ChannelCacheEntry_t gChannelCache[CHANNEL_CACHE_SIZE];
+// Slots, most recently used first. Those past gChannelCacheCount are free.
+static uint8_t gChannelCacheOrder[CHANNEL_CACHE_SIZE] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+static uint8_t gChannelCacheCount;
+
+uint32_t gChannelCacheHits;
+uint32_t gChannelCacheMisses;
+
+static const ChannelCacheEntry_t *RADIO_FetchChannel(uint8_t Channel, bool bCount)
+{
+    ChannelCacheEntry_t *pEntry;
+    uint8_t Slot;
+    uint8_t i;
+
+    for (i = 0; i < gChannelCacheCount; i++)
     {
-        switch (VFO)
+        if (gChannelCache[gChannelCacheOrder[i]].Channel == Channel)
         {
-        case 0:
-            if ((Attributes & MR_CH_SCANLIST1) == 0)
-            {
-                return false;
-            }
-            PriorityCh1 = gEeprom.SCANLIST_PRIORITY_CH1[0];
-            PriorityCh2 = gEeprom.SCANLIST_PRIORITY_CH2[0];
             break;
-        case 1:
-            if ((Attributes & MR_CH_SCANLIST2) == 0)
-            {
-                return false;
-            }
-            PriorityCh1 = gEeprom.SCANLIST_PRIORITY_CH1[1];
-            PriorityCh2 = gEeprom.SCANLIST_PRIORITY_CH2[1];
-            break;
-        default:
-            return true;
         }
-        if (PriorityCh1 == Channel)
+    }
+
+    if (i < gChannelCacheCount)
+    {
+        if (bCount)
         {
-            return false;
+            gChannelCacheHits++;
         }
-        if (PriorityCh2 == Channel)
+    }
+    else
+    {
+        if (bCount)
         {
-            return false;
+            gChannelCacheMisses++;
         }
+        if (gChannelCacheCount < CHANNEL_CACHE_SIZE)
+        {
+            i = gChannelCacheCount++;
+        }
+        else
+        {
+            i = CHANNEL_CACHE_SIZE - 1;
+        }
+        pEntry = &gChannelCache[gChannelCacheOrder[i]];
+        pEntry->Channel = Channel;
+        EEPROM_ReadBuffer(Channel * 16, pEntry->Record, sizeof(pEntry->Record));
+        EEPROM_ReadBuffer(0x0F50 + (Channel * 0x10), pEntry->Name, sizeof(pEntry->Name));
+    }
+
+    Slot = gChannelCacheOrder[i];
+    for (; i > 0; i--)
+    {
+        gChannelCacheOrder[i] = gChannelCacheOrder[i - 1];
     }
+    gChannelCacheOrder[0] = Slot;
 
-    return true;
+    return &gChannelCache[Slot];
 }
 
+void RADIO_PrefetchChannel(uint8_t Channel)
+{
+    if (IS_MR_CHANNEL(Channel))
+    {
+        RADIO_FetchChannel(Channel, false);
+    }
+}
+
+void RADIO_InvalidateChannelCache(uint8_t Channel)
+{
+    uint8_t i;
+
+    if (Channel == 0xFF)
+    {
+        gChannelCacheCount = 0;
+        return;
+    }
+
+    for (i = 0; i < gChannelCacheCount; i++)
+    {
+        if (gChannelCache[gChannelCacheOrder[i]].Channel == Channel)
+        {
+            // Hand the slot back to the free ones
+            const uint8_t Slot = gChannelCacheOrder[i];
+
+            for (; i < gChannelCacheCount - 1; i++)
+            {
+                gChannelCacheOrder[i] = gChannelCacheOrder[i + 1];
+            }
+            gChannelCacheOrder[i] = Slot;
+            gChannelCacheCount--;
+            return;
+        }
+    }
+}
+
+bool RADIO_CheckValidChannel(uint16_t Channel, bool bCheckScanList, uint8_t VFO)
+{
+    if (!IS_MR_CHANNEL(Channel))
+    {
+        return false;
+    }
+
+    if (!bCheckScanList || VFO > 1)
+    {
+        return RADIO_TestChannelBit(gMR_ChannelValid, Channel);
+    }
+
+    if (!RADIO_TestChannelBit(gMR_ChannelScanList[VFO], Channel))
+    {
+        return false;
+    }
+
+    return Channel != gEeprom.SCANLIST_PRIORITY_CH1[VFO] && Channel != gEeprom.SCANLIST_PRIORITY_CH2[VFO];
+}
+
+// Direction is +1 or -1. The search starts at Channel itself and wraps
+// around the memory channels once.
 uint8_t RADIO_FindNextChannel(uint8_t Channel, int8_t Direction, bool bCheckScanList, uint8_t VFO)
 {
+    uint32_t Map[MR_CHANNEL_WORDS];
+    uint8_t Word;
     uint8_t i;
 
-    for (i = 0; i <= MR_CHANNEL_LAST; i++)
+    if (Channel == 0xFF)
+    {
+        Channel = MR_CHANNEL_LAST;
+    }
+    else if (Channel > MR_CHANNEL_LAST)
+    {
+        Channel = MR_CHANNEL_FIRST;
+    }
+
+    if (!bCheckScanList || VFO > 1)
+    {
+        memcpy(Map, gMR_ChannelValid, sizeof(Map));
+    }
+    else
+    {
+        memcpy(Map, gMR_ChannelScanList[VFO], sizeof(Map));
+        // Priority channels are scanned on their own
+        if (IS_MR_CHANNEL(gEeprom.SCANLIST_PRIORITY_CH1[VFO]))
+        {
+            RADIO_AssignChannelBit(Map, gEeprom.SCANLIST_PRIORITY_CH1[VFO], false);
+        }
+        if (IS_MR_CHANNEL(gEeprom.SCANLIST_PRIORITY_CH2[VFO]))
+        {
+            RADIO_AssignChannelBit(Map, gEeprom.SCANLIST_PRIORITY_CH2[VFO], false);
+        }
+    }
+
+    // The starting word is visited twice: from Channel on, and after the
+    // wrap for the part before it
+    Word = Channel >> 5;
+    for (i = 0; i <= MR_CHANNEL_WORDS; i++)
     {
-        if (Channel == 0xFF)
+        uint32_t Bits = Map[Word];
+
+        if (i == 0)
         {
-            Channel = MR_CHANNEL_LAST;
+            if (Direction > 0)
+            {
+                Bits &= 0xFFFFFFFFU << (Channel & 31U);
+            }
+            else
+            {
+                Bits &= 0xFFFFFFFFU >> (31U - (Channel & 31U));
+            }
         }
-        else if (Channel > MR_CHANNEL_LAST)
+        if (Bits)
         {
-            Channel = MR_CHANNEL_FIRST;
+            if (Direction > 0)
+            {
+                return (Word << 5) + __builtin_ctz(Bits);
+            }
+            return (Word << 5) + 31 - __builtin_clz(Bits);
+        }
+        if (Direction > 0)
+        {
+            Word = (Word + 1) % MR_CHANNEL_WORDS;
         }
-        if (RADIO_CheckValidChannel(Channel, bCheckScanList, VFO))
+        else
         {
-            return Channel;
+            Word = (Word + MR_CHANNEL_WORDS - 1) % MR_CHANNEL_WORDS;
         }
-        Channel += Direction;
     }
 
     return 0xFF;
@@ -156,7 +331,8 @@ void RADIO_ConfigureChannel(uint8_t VFO, uint32_t Configure)
     uint8_t Band;
     bool bParticipation2;
     uint16_t Base;
-    uint8_t Data[8];
+    uint8_t Record[16];
+    uint8_t *Data = Record + 8;
     uint8_t Tmp;
     uint32_t Frequency;
 
@@ -258,7 +434,14 @@ void RADIO_ConfigureChannel(uint8_t VFO, uint32_t Configure)
 
     if (Configure == VFO_CONFIGURE_RELOAD || Channel >= FREQ_CHANNEL_FIRST)
     {
-        EEPROM_ReadBuffer(Base + 8, Data, 8);
+        if (IS_MR_CHANNEL(Channel))
+        {
+            memcpy(Record, RADIO_FetchChannel(Channel, true)->Record, sizeof(Record));
+        }
+        else
+        {
+            EEPROM_ReadBuffer(Base, Record, sizeof(Record));
+        }
 
         Tmp = Data[3] & 0x0F;
         if (Tmp > 2)
@@ -362,7 +545,7 @@ void RADIO_ConfigureChannel(uint8_t VFO, uint32_t Configure)
             uint32_t Offset;
         } Info;
 
-        EEPROM_ReadBuffer(Base, &Info, 8);
+        memcpy(&Info, Record, sizeof(Info));
 
         pRadio->ConfigRX.Frequency = Info.Frequency;
         if (Info.Offset >= 100000000)
@@ -400,8 +583,7 @@ void RADIO_ConfigureChannel(uint8_t VFO, uint32_t Configure)
     if (IS_MR_CHANNEL(Channel))
     {
         // 16 bytes allocated but only 12 used
-        EEPROM_ReadBuffer(0x0F50 + (Channel * 0x10), gEeprom.VfoInfo[VFO].Name + 0, 8);
-        EEPROM_ReadBuffer(0x0F58 + (Channel * 0x10), gEeprom.VfoInfo[VFO].Name + 8, 2);
+        memcpy(gEeprom.VfoInfo[VFO].Name, RADIO_FetchChannel(Channel, false)->Name, 10);
     }
 
     if (!gEeprom.VfoInfo[VFO].FrequencyReverse)
@@ -442,20 +624,11 @@ void RADIO_ConfigureChannel(uint8_t VFO, uint32_t Configure)
 
 void RADIO_ConfigureSquelchAndOutputPower(VFO_Info_t *pInfo)
 {
-    uint8_t Txp[3];
-    uint16_t Base;
+    const uint8_t *pTxp;
+    uint8_t Group;
+    uint8_t Level;
     FREQUENCY_Band_t Band;
 
-    Band = FREQUENCY_GetBand(pInfo->pRX->Frequency);
-    if (Band < BAND4_174MHz)
-    {
-        Base = 0x1E60;
-    }
-    else
-    {
-        Base = 0x1E00;
-    }
-
     if (gEeprom.SQUELCH_LEVEL == 0)
     {
         pInfo->SquelchOpenRSSI = 0x00;
@@ -467,13 +640,16 @@ void RADIO_ConfigureSquelchAndOutputPower(VFO_Info_t *pInfo)
     }
     else
     {
-        Base += gEeprom.SQUELCH_LEVEL;
-        EEPROM_ReadBuffer(Base + 0x00, &pInfo->SquelchOpenRSSI, 1);
-        EEPROM_ReadBuffer(Base + 0x10, &pInfo->SquelchCloseRSSI, 1);
-        EEPROM_ReadBuffer(Base + 0x20, &pInfo->SquelchOpenNoise, 1);
-        EEPROM_ReadBuffer(Base + 0x30, &pInfo->SquelchCloseNoise, 1);
-        EEPROM_ReadBuffer(Base + 0x40, &pInfo->SquelchCloseGlitch, 1);
-        EEPROM_ReadBuffer(Base + 0x50, &pInfo->SquelchOpenGlitch, 1);
+        // Tables loaded by BOARD_EEPROM_LoadCalibration()
+        Band = FREQUENCY_GetBand(pInfo->pRX->Frequency);
+        Group = (Band < BAND4_174MHz) ? 1 : 0;
+        Level = gEeprom.SQUELCH_LEVEL;
+        pInfo->SquelchOpenRSSI = gEEPROM_SQUELCH_CALIB[Group][0][Level];
+        pInfo->SquelchCloseRSSI = gEEPROM_SQUELCH_CALIB[Group][1][Level];
+        pInfo->SquelchOpenNoise = gEEPROM_SQUELCH_CALIB[Group][2][Level];
+        pInfo->SquelchCloseNoise = gEEPROM_SQUELCH_CALIB[Group][3][Level];
+        pInfo->SquelchCloseGlitch = gEEPROM_SQUELCH_CALIB[Group][4][Level];
+        pInfo->SquelchOpenGlitch = gEEPROM_SQUELCH_CALIB[Group][5][Level];
         if (pInfo->SquelchOpenNoise >= 0x80)
         {
             pInfo->SquelchOpenNoise = 0x7F;
@@ -485,15 +661,13 @@ void RADIO_ConfigureSquelchAndOutputPower(VFO_Info_t *pInfo)
     }
 
     Band = FREQUENCY_GetBand(pInfo->pTX->Frequency);
-    EEPROM_ReadBuffer(0x1ED0 + (Band * 0x10) + (pInfo->OUTPUT_POWER * 3), Txp, 3);
+    pTxp = &gEEPROM_TXP_CALIB[Band][pInfo->OUTPUT_POWER * 3];
     pInfo->TXP_CalculatedSetting =
         FREQUENCY_CalculateOutputPower(
-            Txp[0],
-            Txp[1],
-            Txp[2],
-            LowerLimitFrequencyBandTable[Band],
-            MiddleFrequencyBandTable[Band],
-            UpperLimitFrequencyBandTable[Band],
+            pTxp[0],
+            pTxp[1],
+            pTxp[2],
+            Band,
             pInfo->pTX->Frequency);
 }
 
@@ -585,6 +759,9 @@ void RADIO_SetupRegisters(bool bSwitchToFunction0)
     uint16_t InterruptMask;
     uint32_t Frequency;
 
+    AUDIO_FinishBeep();
+    DTMF_FinishTx();
+
     // GPIO_ClearBit(&GPIOC->DATA, GPIOC_PIN_AUDIO_PATH);
     GPIO_ResetAudioPath();
     gEnableSpeaker = false;
@@ -991,6 +1168,9 @@ static void _SendCssTail(void)
 
 void RADIO_SendEndOfTransmission(void)
 {
+    // A PTT-ID from the start of the transmission may still be going
+    DTMF_FinishTx();
+
     if (gEeprom.ROGER == ROGER_MODE_ROGER)
     {
         BK4819_PlayRoger();
@@ -1001,26 +1181,23 @@ void RADIO_SendEndOfTransmission(void)
     }
     if (gDTMF_CallState == DTMF_CALL_STATE_NONE && (gCurrentVfo->DTMF_PTT_ID_TX_MODE == PTT_ID_EOT || gCurrentVfo->DTMF_PTT_ID_TX_MODE == PTT_ID_BOTH))
     {
+        uint16_t Preload = 0;
+
         if (gEeprom.DTMF_SIDE_TONE)
         {
             // GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_AUDIO_PATH);
             GPIO_SetAudioPath();
             gEnableSpeaker = true;
-            SYSTEM_DelayMs(60);
+            Preload = 60;
         }
-        BK4819_EnterDTMF_TX(gEeprom.DTMF_SIDE_TONE);
-        BK4819_PlayDTMFString(
-            gEeprom.DTMF_DOWN_CODE,
-            0,
-            gEeprom.DTMF_FIRST_CODE_PERSIST_TIME,
-            gEeprom.DTMF_HASH_CODE_PERSIST_TIME,
-            gEeprom.DTMF_CODE_PERSIST_TIME,
-            gEeprom.DTMF_CODE_INTERVAL_TIME);
-        // GPIO_ClearBit(&GPIOC->DATA, GPIOC_PIN_AUDIO_PATH);
-        GPIO_ResetAudioPath();
-        gEnableSpeaker = false;
-    }
-    BK4819_ExitDTMF_TX(true);
+        // The transmitter goes off right after, so wait for the last code
+        DTMF_SendString(gEeprom.DTMF_DOWN_CODE, Preload, false, true);
+        DTMF_FinishTx();
+    }
+    else
+    {
+        BK4819_ExitDTMF_TX(true);
+    }
 
     // send the CTCSS/DCS tail tone - allows the receivers to mute the usual FM squelch tail/crash
     if (gEeprom.TAIL_NOTE_ELIMINATION)
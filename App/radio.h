@@ -121,6 +121,13 @@ extern STEP_Setting_t gStepSetting;
 
 extern VfoState_t VfoState[2];
 
+extern uint32_t gChannelCacheHits;
+extern uint32_t gChannelCacheMisses;
+
+void RADIO_UpdateChannelBitmaps(uint8_t Channel);
+void RADIO_InitChannelBitmaps(void);
+void RADIO_PrefetchChannel(uint8_t Channel);
+void RADIO_InvalidateChannelCache(uint8_t Channel);
 bool RADIO_CheckValidChannel(uint16_t ChNum, bool bCheckScanList, uint8_t RadioNum);
 uint8_t RADIO_FindNextChannel(uint8_t ChNum, int8_t Direction, bool bCheckScanList, uint8_t RadioNum);
 void RADIO_InitInfo(VFO_Info_t *pInfo, uint8_t ChannelSave, uint8_t ChIndex, uint32_t Frequency);
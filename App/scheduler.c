@@ -19,6 +19,8 @@
 #endif
 #include "app/scanner.h"
 #include "audio.h"
+#include "driver/ramfunc.h"
+#include "driver/voice.h"
 #include "functions.h"
 #include "helper/battery.h"
 #include "misc.h"
@@ -37,7 +39,7 @@ static volatile uint32_t gGlobalSysTickCounter;
 
 void SystickHandler(void);
 
-void SystickHandler(void)
+RAMFUNC_SYSTICK void SystickHandler(void)
 {
 	gGlobalSysTickCounter++;
 	gNextTimeslice = true;
@@ -90,7 +92,10 @@ void SystickHandler(void)
 
 	DECREMENT_AND_TRIGGER(gTailNoteEliminationCountdown, gFlagTteComplete);
 
-	DECREMENT_AND_TRIGGER(gCountdownToPlayNextVoice, gFlagPlayQueuedVoice);
+	// The clip starts once its ID is out
+	if (!VOICE_IsBusy()) {
+		DECREMENT_AND_TRIGGER(gCountdownToPlayNextVoice, gFlagPlayQueuedVoice);
+	}
 
 #if defined(ENABLE_FMRADIO)
 	if (gFM_ScanState != FM_SCAN_OFF && gCurrentFunction != FUNCTION_MONITOR) {
@@ -233,6 +233,7 @@ void SETTINGS_SaveChannel(uint8_t Channel, uint8_t VFO, const VFO_Info_t *pVFO,
 				memset(&State32, 0x00, sizeof(State32));
 				EEPROM_WriteBuffer(OffsetMR + 0x0F50, State32);
 				EEPROM_WriteBuffer(OffsetMR + 0x0F58, State32);
+				RADIO_InvalidateChannelCache(Channel);
 			}
 		}
 	}
@@ -265,6 +266,7 @@ void SETTINGS_UpdateChannel(uint8_t Channel, const VFO_Info_t *pVFO, bool bUpdat
 		State[Channel & 7U] = Attributes;
 		EEPROM_WriteBuffer(Offset, State);
 		gMR_ChannelAttributes[Channel] = Attributes;
+		RADIO_UpdateChannelBitmaps(Channel);
 	}
 }
 
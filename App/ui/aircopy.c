@@ -18,6 +18,7 @@
 #include "app/aircopy.h"
 #include "driver/st7565.h"
 #include <stdio.h>
+#include "helper/format.h"
 #include "misc.h"
 #include "radio.h"
 #include "ui/aircopy.h"
@@ -27,15 +28,15 @@
 void UI_DisplayAircopy(void)
 {
 	char String[16];
+	char *pString;
 
 	memset(gFrameBuffer, 0, sizeof(gFrameBuffer));
 
+	strcpy(String, gAircopyMode == AIRCOPY_MODE_V2 ? "AIR COPY2" : "AIR COPY");
 	if (gAircopyState == AIRCOPY_READY) {
-		strcpy(String, "AIR COPY(RDY)");
-	} else if (gAircopyState == AIRCOPY_TRANSFER) {
-		strcpy(String, "AIR COPY");
-	} else {
-		strcpy(String, "AIR COPY(CMP)");
+		strcat(String, "(RDY)");
+	} else if (gAircopyState == AIRCOPY_COMPLETE) {
+		strcat(String, "(CMP)");
 	}
 	UI_PrintString(String, 2, 127, 0, 8, true);
 
@@ -49,10 +50,16 @@ void UI_DisplayAircopy(void)
 
 	memset(String, 0, sizeof(String));
 
-	if (gAirCopyIsSendMode == 0) {
-		sprintf(String, "RCV:%d E:%d", gAirCopyBlockNumber, gErrorsDuringAirCopy);
+	if (gAirCopyIsSendMode == 0 && gAircopyDroppedFrames) {
+		snprintf(String, sizeof(String), "R:%d E:%d D:%d", gAirCopyBlockNumber, gErrorsDuringAirCopy, gAircopyDroppedFrames);
+	} else if (gAirCopyIsSendMode == 0) {
+		pString = FORMAT_String(String, "RCV:");
+		pString = FORMAT_Decimal(pString, gAirCopyBlockNumber, 0);
+		pString = FORMAT_String(pString, " E:");
+		FORMAT_Decimal(pString, gErrorsDuringAirCopy, 0);
 	} else if (gAirCopyIsSendMode == 1) {
-		sprintf(String, "SND:%d", gAirCopyBlockNumber);
+		pString = FORMAT_String(String, "SND:");
+		FORMAT_Decimal(pString, gAirCopyBlockNumber, 0);
 	}
 	UI_PrintString(String, 2, 127, 4, 8, true);
 	ST7565_BlitFullScreen();
@@ -17,7 +17,7 @@
 #include <string.h>
 #include "app/fm.h"
 #include "driver/st7565.h"
-#include <stdio.h>
+#include "helper/format.h"
 #include "misc.h"
 #include "settings.h"
 #include "ui/fmradio.h"
@@ -29,6 +29,7 @@ void UI_DisplayFM(void)
 {
 	uint8_t i;
 	char String[16];
+	char *pString;
 
 	memset(gFrameBuffer, 0, sizeof(gFrameBuffer));
 
@@ -47,7 +48,9 @@ void UI_DisplayFM(void)
 			if (!gEeprom.FM_IsMrMode) {
 				for (i = 0; i < 20; i++) {
 					if (gEeprom.FM_FrequencyPlaying == gFM_Channels[i]) {
-						sprintf(String, "VFO(CH%02d)", i + 1);
+						pString = FORMAT_String(String, "VFO(CH");
+						pString = FORMAT_Decimal(pString, i + 1, 2);
+						FORMAT_String(pString, ")");
 						break;
 					}
 				}
@@ -55,13 +58,17 @@ void UI_DisplayFM(void)
 					strcpy(String, "VFO");
 				}
 			} else {
-				sprintf(String, "MR(CH%02d)", gEeprom.FM_SelectedChannel + 1);
+				pString = FORMAT_String(String, "MR(CH");
+				pString = FORMAT_Decimal(pString, gEeprom.FM_SelectedChannel + 1, 2);
+				FORMAT_String(pString, ")");
 			}
 		} else {
 			if (!gFM_AutoScan) {
 				strcpy(String, "M-SCAN");
 			} else {
-				sprintf(String, "A-SCAN(%d)", gFM_ChannelPosition + 1);
+				pString = FORMAT_String(String, "A-SCAN(");
+				pString = FORMAT_Decimal(pString, gFM_ChannelPosition + 1, 0);
+				FORMAT_String(pString, ")");
 			}
 		}
 	}
@@ -81,7 +88,8 @@ void UI_DisplayFM(void)
 		ST7565_BlitFullScreen();
 		return;
 	} else {
-		sprintf(String, "CH-%02d", gEeprom.FM_SelectedChannel + 1);
+		pString = FORMAT_String(String, "CH-");
+		FORMAT_Decimal(pString, gEeprom.FM_SelectedChannel + 1, 2);
 	}
 
 	UI_PrintString(String, 0, 127, 4, 10, true);
@@ -16,8 +16,8 @@
 
 #include <string.h>
 #include "driver/st7565.h"
-#include <stdio.h>
 #include "font.h"
+#include "helper/format.h"
 #include "ui/helper.h"
 #include "ui/inputbox.h"
 
@@ -26,7 +26,7 @@ void UI_GenerateChannelString(char *pString, uint8_t Channel)
 	uint8_t i;
 
 	if (gInputBoxIndex == 0) {
-		sprintf(pString, "CH-%02d", Channel + 1);
+		FORMAT_Decimal(FORMAT_String(pString, "CH-"), Channel + 1, 2);
 		return;
 	}
 
@@ -60,16 +60,28 @@ void UI_GenerateChannelStringEx(char *pString, bool bShowPrefix, uint8_t Channel
 	}
 
 	if (bShowPrefix) {
-		sprintf(pString, "CH-%03d", ChannelNumber + 1);
+		FORMAT_Decimal(FORMAT_String(pString, "CH-"), ChannelNumber + 1, 3);
 	} else {
 		if (ChannelNumber == 0xFF) {
 			strcpy(pString, "NULL");
 		} else {
-			sprintf(pString, "%03d", ChannelNumber + 1);
+			FORMAT_Decimal(pString, ChannelNumber + 1, 3);
 		}
 	}
 }
 
+static void DrawGlyph(uint8_t *pLine0, uint8_t *pLine1, const uint8_t *pGlyph, uint8_t Width)
+{
+	uint8_t i;
+
+	for (i = 0; i < Width; i++) {
+		const uint8_t *pColumn = gFontColumns[pGlyph[i]];
+
+		pLine0[i] = pColumn[0];
+		pLine1[i] = pColumn[1];
+	}
+}
+
 void UI_PrintString(const char *pString, uint8_t Start, uint8_t End, uint8_t Line, uint8_t Width, bool bCentered)
 {
 	uint32_t i, Length;
@@ -81,8 +93,7 @@ void UI_PrintString(const char *pString, uint8_t Start, uint8_t End, uint8_t Lin
 	for (i = 0; i < Length; i++) {
 		if (pString[i] >= ' ' && pString[i] < 0x7F) {
 			uint8_t Index = pString[i] - ' ';
-			memcpy(gFrameBuffer[Line + 0] + (i * Width) + Start, &gFontBig[Index][0], 8);
-			memcpy(gFrameBuffer[Line + 1] + (i * Width) + Start, &gFontBig[Index][8], 8);
+			DrawGlyph(gFrameBuffer[Line + 0] + (i * Width) + Start, gFrameBuffer[Line + 1] + (i * Width) + Start, gFontBig[Index], 8);
 		}
 	}
 }
@@ -102,8 +113,7 @@ void UI_DisplayFrequency(const char *pDigits, uint8_t X, uint8_t Y, bool bDispla
 
 		if (bDisplayLeadingZero || bCanDisplay || Digit) {
 			bCanDisplay = true;
-			memcpy(pFb0 + (i * 13), gFontBigDigits[Digit] +  0, 13);
-			memcpy(pFb1 + (i * 13), gFontBigDigits[Digit] + 13, 13);
+			DrawGlyph(pFb0 + (i * 13), pFb1 + (i * 13), gFontBigDigits[Digit], 13);
 		} else if (bFlag) {
 			pFb1 -= 6;
 			pFb0 -= 6;
@@ -117,8 +127,7 @@ void UI_DisplayFrequency(const char *pDigits, uint8_t X, uint8_t Y, bool bDispla
 	for (i = 0; i < 3; i++) {
 		const uint8_t Digit = pDigits[i + 3];
 
-		memcpy(pFb0 + (i * 13) + 42, gFontBigDigits[Digit] +  0, 13);
-		memcpy(pFb1 + (i * 13) + 42, gFontBigDigits[Digit] + 13, 13);
+		DrawGlyph(pFb0 + (i * 13) + 42, pFb1 + (i * 13) + 42, gFontBigDigits[Digit], 13);
 	}
 }
 
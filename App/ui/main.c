@@ -18,8 +18,8 @@
 #include "app/dtmf.h"
 #include "bitmaps.h"
 #include "driver/st7565.h"
-#include <stdio.h>
 #include "functions.h"
+#include "helper/format.h"
 #include "misc.h"
 #include "radio.h"
 #include "settings.h"
@@ -36,6 +36,7 @@ enum {
 void UI_DisplayMain(void)
 {
 	char String[16];
+	char *pString;
 	uint8_t i;
 
 	memset(gFrameBuffer, 0, sizeof(gFrameBuffer));
@@ -83,9 +84,11 @@ void UI_DisplayMain(void)
 						}
 					} else if (gDTMF_CallState == DTMF_CALL_STATE_RECEIVED) {
 						if (DTMF_FindContact(gDTMF_Caller, Contact)) {
-							sprintf(String, "CALL:%s", Contact);
+							pString = FORMAT_String(String, "CALL:");
+							FORMAT_String(pString, Contact);
 						} else {
-							sprintf(String, "CALL:%s", gDTMF_Caller);
+							pString = FORMAT_String(String, "CALL:");
+							FORMAT_String(pString, gDTMF_Caller);
 						}
 					} else if (gDTMF_IsTx) {
 						if (gDTMF_State == DTMF_STATE_TX_SUCC) {
@@ -95,7 +98,8 @@ void UI_DisplayMain(void)
 						}
 					}
 				} else {
-					sprintf(String, ">%s", gDTMF_InputBox);
+					pString = FORMAT_String(String, ">");
+					FORMAT_String(pString, gDTMF_InputBox);
 				}
 				UI_PrintString(String, 2, 127, i * 3, 8, false);
 
@@ -105,18 +109,23 @@ void UI_DisplayMain(void)
 				if (!gDTMF_InputMode) {
 					if (gDTMF_CallState == DTMF_CALL_STATE_CALL_OUT) {
 						if (DTMF_FindContact(gDTMF_String, Contact)) {
-							sprintf(String, ">%s", Contact);
+							pString = FORMAT_String(String, ">");
+							FORMAT_String(pString, Contact);
 						} else {
-							sprintf(String, ">%s", gDTMF_String);
+							pString = FORMAT_String(String, ">");
+							FORMAT_String(pString, gDTMF_String);
 						}
 					} else if (gDTMF_CallState == DTMF_CALL_STATE_RECEIVED) {
 						if (DTMF_FindContact(gDTMF_Callee, Contact)) {
-							sprintf(String, ">%s", Contact);
+							pString = FORMAT_String(String, ">");
+							FORMAT_String(pString, Contact);
 						} else {
-							sprintf(String, ">%s", gDTMF_Callee);
+							pString = FORMAT_String(String, ">");
+							FORMAT_String(pString, gDTMF_Callee);
 						}
 					} else if (gDTMF_IsTx) {
-						sprintf(String, ">%s", gDTMF_String);
+						pString = FORMAT_String(String, ">");
+						FORMAT_String(pString, gDTMF_String);
 					}
 				}
 				UI_PrintString(String, 2, 127, 2 + (i * 3), 8, false);
@@ -227,7 +236,7 @@ void UI_DisplayMain(void)
 				break;
 #endif
 			case 6:
-				sprintf(String, "VOL HIGH");
+				strcpy(String, "VOL HIGH");
 				Width = 8;
 				break;
 			}
@@ -263,11 +272,13 @@ void UI_DisplayMain(void)
 					}
 					UI_DisplaySmallDigits(2, String + 6, 112, Line + 1);
 				} else if (gEeprom.CHANNEL_DISPLAY_MODE == MDF_CHANNEL) {
-					sprintf(String, "CH-%03d", gEeprom.ScreenChannel[i] + 1);
+					pString = FORMAT_String(String, "CH-");
+					FORMAT_Decimal(pString, gEeprom.ScreenChannel[i] + 1, 3);
 					UI_PrintString(String, 31, 112, i * 4, 8, true);
 				} else if (gEeprom.CHANNEL_DISPLAY_MODE == MDF_NAME) {
 					if(gEeprom.VfoInfo[i].Name[0] == 0 || gEeprom.VfoInfo[i].Name[0] == 0xFF) {
-						sprintf(String, "CH-%03d", gEeprom.ScreenChannel[i] + 1);
+						pString = FORMAT_String(String, "CH-");
+						FORMAT_Decimal(pString, gEeprom.ScreenChannel[i] + 1, 3);
 						UI_PrintString(String, 31, 112, i * 4, 8, true);
 					} else {
 						UI_PrintString(gEeprom.VfoInfo[i].Name, 31, 112, i * 4, 8, true);
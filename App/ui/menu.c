@@ -19,8 +19,8 @@
 #include "bitmaps.h"
 #include "dcs.h"
 #include "driver/st7565.h"
-#include <stdio.h>
 #include "helper/battery.h"
+#include "helper/format.h"
 #include "misc.h"
 #include "settings.h"
 #include "ui/helper.h"
@@ -223,6 +223,7 @@ void UI_DisplayMenu(void)
 {
     char String[16];
     char Contact[16];
+    char *pString;
     uint8_t i;
 
     memset(gFrameBuffer, 0, sizeof(gFrameBuffer));
@@ -260,11 +261,12 @@ void UI_DisplayMenu(void)
     {
     case MENU_SQL:
     case MENU_MIC:
-        sprintf(String, "%ld", gSubMenuSelection);
+        FORMAT_Decimal(String, gSubMenuSelection, 0);
         break;
 
     case MENU_STEP:
-        sprintf(String, "%d.%02dKHz", gSubMenu_Step[gSubMenuSelection] / 100, gSubMenu_Step[gSubMenuSelection] % 100);
+        pString = FORMAT_Fixed(String, gSubMenu_Step[gSubMenuSelection], 2, 2);
+        FORMAT_String(pString, "KHz");
         break;
 
     case MENU_TXP:
@@ -279,11 +281,15 @@ void UI_DisplayMenu(void)
         }
         else if (gSubMenuSelection < 105)
         {
-            sprintf(String, "D%03oN", DCS_Options[gSubMenuSelection - 1]);
+            pString = FORMAT_String(String, "D");
+            pString = FORMAT_Octal(pString, DCS_Options[gSubMenuSelection - 1], 3);
+            FORMAT_String(pString, "N");
         }
         else
         {
-            sprintf(String, "D%03oI", DCS_Options[gSubMenuSelection - 105]);
+            pString = FORMAT_String(String, "D");
+            pString = FORMAT_Octal(pString, DCS_Options[gSubMenuSelection - 105], 3);
+            FORMAT_String(pString, "I");
         }
         break;
 
@@ -295,7 +301,8 @@ void UI_DisplayMenu(void)
         }
         else
         {
-            sprintf(String, "%d.%dHz", CTCSS_Options[gSubMenuSelection - 1] / 10, CTCSS_Options[gSubMenuSelection - 1] % 10);
+            pString = FORMAT_Fixed(String, CTCSS_Options[gSubMenuSelection - 1], 1, 1);
+            FORMAT_String(pString, "Hz");
         }
         break;
 
@@ -306,7 +313,7 @@ void UI_DisplayMenu(void)
     case MENU_OFFSET:
         if (!gIsInSubMenu || gInputBoxIndex == 0)
         {
-            sprintf(String, "%ld.%05ld", gSubMenuSelection / 100000, gSubMenuSelection % 100000);
+            FORMAT_Frequency(String, gSubMenuSelection, 5);
             break;
         }
         for (i = 0; i < 3; i++)
@@ -352,7 +359,7 @@ void UI_DisplayMenu(void)
         }
         else
         {
-            sprintf(String, "%ld", gSubMenuSelection);
+            FORMAT_Decimal(String, gSubMenuSelection, 0);
         }
         break;
 
@@ -401,7 +408,8 @@ void UI_DisplayMenu(void)
         }
         else
         {
-            sprintf(String, "%ldmin", gSubMenuSelection);
+            pString = FORMAT_Decimal(String, gSubMenuSelection, 0);
+            FORMAT_String(pString, "min");
         }
         break;
 
@@ -424,17 +432,19 @@ void UI_DisplayMenu(void)
         }
         else
         {
-            sprintf(String, "%ld*100ms", gSubMenuSelection);
+            pString = FORMAT_Decimal(String, gSubMenuSelection, 0);
+            FORMAT_String(pString, "*100ms");
         }
         break;
 
     case MENU_S_LIST:
-        sprintf(String, "LIST%ld", gSubMenuSelection);
+        pString = FORMAT_String(String, "LIST");
+        FORMAT_Decimal(pString, gSubMenuSelection, 0);
         break;
 
 #if defined(ENABLE_ALARM)
     case MENU_AL_MOD:
-        sprintf(String, gSubMenu_AL_MOD[gSubMenuSelection]);
+        strcpy(String, gSubMenu_AL_MOD[gSubMenuSelection]);
         break;
 #endif
 
@@ -455,11 +465,13 @@ void UI_DisplayMenu(void)
         break;
 
     case MENU_D_HOLD:
-        sprintf(String, "%lds", gSubMenuSelection);
+        pString = FORMAT_Decimal(String, gSubMenuSelection, 0);
+        FORMAT_String(pString, "s");
         break;
 
     case MENU_D_PRE:
-        sprintf(String, "%ld*10ms", gSubMenuSelection);
+        pString = FORMAT_Decimal(String, gSubMenuSelection, 0);
+        FORMAT_String(pString, "*10ms");
         break;
 
     case MENU_PTT_ID:
@@ -488,7 +500,8 @@ void UI_DisplayMenu(void)
         break;
 
     case MENU_VOL:
-        sprintf(String, "%d.%02dV", gBatteryVoltageAverage / 100, gBatteryVoltageAverage % 100);
+        pString = FORMAT_Fixed(String, gBatteryVoltageAverage, 2, 2);
+        FORMAT_String(pString, "V");
         break;
 
     case MENU_RESET:
@@ -565,7 +578,8 @@ void UI_DisplayMenu(void)
     {
         Contact[11] = 0;
         memcpy(&gDTMF_ID, Contact + 8, 4);
-        sprintf(String, "ID:%s", Contact + 8);
+        pString = FORMAT_String(String, "ID:");
+        FORMAT_String(pString, Contact + 8);
         UI_PrintString(String, 50, 127, 4, 8, true);
     }
 
@@ -585,7 +599,7 @@ void UI_DisplayMenu(void)
 
         if (gSubMenuSelection == 0xFF)
         {
-            sprintf(String, "NULL");
+            strcpy(String, "NULL");
         }
         else
         {
@@ -601,12 +615,14 @@ void UI_DisplayMenu(void)
             UI_PrintString(String, 50, 127, 0, 8, true);
             if (IS_MR_CHANNEL(gEeprom.SCANLIST_PRIORITY_CH1[i]))
             {
-                sprintf(String, "PRI1:%d", gEeprom.SCANLIST_PRIORITY_CH1[i] + 1);
+                pString = FORMAT_String(String, "PRI1:");
+                FORMAT_Decimal(pString, gEeprom.SCANLIST_PRIORITY_CH1[i] + 1, 0);
                 UI_PrintString(String, 50, 127, 2, 8, true);
             }
             if (IS_MR_CHANNEL(gEeprom.SCANLIST_PRIORITY_CH2[i]))
             {
-                sprintf(String, "PRI2:%d", gEeprom.SCANLIST_PRIORITY_CH2[i] + 1);
+                pString = FORMAT_String(String, "PRI2:");
+                FORMAT_Decimal(pString, gEeprom.SCANLIST_PRIORITY_CH2[i] + 1, 0);
                 UI_PrintString(String, 50, 127, 4, 8, true);
             }
         }
@@ -19,7 +19,7 @@
 #include "app/scanner.h"
 #include "dcs.h"
 #include "driver/st7565.h"
-#include <stdio.h>
+#include "helper/format.h"
 #include "misc.h"
 #include "ui/helper.h"
 #include "ui/scanner.h"
@@ -27,6 +27,7 @@
 void UI_DisplayScanner(void)
 {
 	char String[16];
+	char *pString;
 	bool bCentered;
 	uint8_t Start;
 
@@ -34,19 +35,24 @@ void UI_DisplayScanner(void)
 	memset(String, 0, sizeof(String));
 
 	if (gScanSingleFrequency || (gScanCssState != SCAN_CSS_STATE_OFF && gScanCssState != SCAN_CSS_STATE_FAILED)) {
-		sprintf(String, "FREQ:%ld.%05ld", gScanFrequency / 100000, gScanFrequency % 100000);
+		pString = FORMAT_String(String, "FREQ:");
+		FORMAT_Frequency(pString, gScanFrequency, 5);
 	} else {
-		sprintf(String, "FREQ:**.*****");
+		strcpy(String, "FREQ:**.*****");
 	}
 	UI_PrintString(String, 2, 127, 1, 8, false);
 	memset(String, 0, sizeof(String));
 
 	if (gScanCssState < SCAN_CSS_STATE_FOUND || !gScanUseCssResult) {
-		sprintf(String, "CTC:******");
+		strcpy(String, "CTC:******");
 	} else if (gScanCssResultType == CODE_TYPE_CONTINUOUS_TONE) {
-		sprintf(String, "CTC:%d.%dHz", CTCSS_Options[gScanCssResultCode] / 10, CTCSS_Options[gScanCssResultCode] % 10);
+		pString = FORMAT_String(String, "CTC:");
+		pString = FORMAT_Fixed(pString, CTCSS_Options[gScanCssResultCode], 1, 1);
+		FORMAT_String(pString, "Hz");
 	} else {
-		sprintf(String, "DCS:D%03oN", DCS_Options[gScanCssResultCode]);
+		pString = FORMAT_String(String, "DCS:D");
+		pString = FORMAT_Octal(pString, DCS_Options[gScanCssResultCode], 3);
+		FORMAT_String(pString, "N");
 	}
 	UI_PrintString(String, 2, 127, 3, 8, false);
 	memset(String, 0, sizeof(String));
@@ -0,0 +1,86 @@
+/* Copyright 2025 muzkr https://github.com/muzkr
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+
+#include <string.h>
+#include "app/spectrum.h"
+#include "driver/st7565.h"
+#include "helper/format.h"
+#include "ui/helper.h"
+#include "ui/spectrum.h"
+
+// The graph uses frame buffer lines 2 to 6, the bottom pixel is -140 dBm
+// (halved RSSI 20) and every pixel is another 2 dB
+#define GRAPH_LINE	2U
+#define GRAPH_HEIGHT	40U
+#define GRAPH_FLOOR	20U
+
+static uint8_t GetHeight(uint8_t Rssi)
+{
+	if (Rssi <= GRAPH_FLOOR) {
+		return 0;
+	}
+	Rssi = (Rssi - GRAPH_FLOOR) / 2;
+	return Rssi < GRAPH_HEIGHT ? Rssi : GRAPH_HEIGHT;
+}
+
+static void DrawColumn(uint8_t X, uint8_t Height, uint8_t Peak)
+{
+	const uint8_t Top = GRAPH_HEIGHT - Height;
+	uint8_t i;
+
+	for (i = 0; i < GRAPH_HEIGHT / 8; i++) {
+		const uint8_t Y = i * 8;
+		uint8_t Bits;
+
+		if (Top <= Y) {
+			Bits = 0xFF;
+		} else if (Top >= Y + 8) {
+			Bits = 0x00;
+		} else {
+			Bits = 0xFF << (Top - Y);
+		}
+		if (Peak && GRAPH_HEIGHT - Peak >= Y && GRAPH_HEIGHT - Peak < Y + 8) {
+			Bits |= 1U << (GRAPH_HEIGHT - Peak - Y);
+		}
+		gFrameBuffer[GRAPH_LINE + i][X] = Bits;
+	}
+}
+
+void UI_DisplaySpectrum(void)
+{
+	const uint16_t Step = SPECTRUM_GetStep();
+	char String[20];
+	char *pString;
+	uint8_t i;
+
+	memset(gFrameBuffer, 0, sizeof(gFrameBuffer));
+
+	pString = FORMAT_Frequency(String, gSpectrumCenter, 4);
+	pString = FORMAT_String(pString, " ");
+	pString = FORMAT_Fixed(pString, Step, 2, 1);
+	FORMAT_String(pString, "K");
+	UI_PrintString(String, 0, 127, 0, 8, true);
+
+	for (i = 0; i < SPECTRUM_POINTS; i++) {
+		DrawColumn(i, GetHeight(gSpectrumRssi[i]), GetHeight(gSpectrumPeak[i]));
+	}
+
+	// Center marker
+	gFrameBuffer[GRAPH_LINE][SPECTRUM_POINTS / 2] |= 0x07;
+
+	ST7565_BlitFullScreen();
+}
+
@@ -30,6 +30,9 @@
 #include "ui/main.h"
 #include "ui/menu.h"
 #include "ui/scanner.h"
+#if defined(ENABLE_SPECTRUM)
+#include "ui/spectrum.h"
+#endif
 #include "ui/ui.h"
 
 GUI_DisplayType_t gScreenToDisplay;
@@ -60,6 +63,11 @@ void GUI_DisplayScreen(void)
 	case DISPLAY_AIRCOPY:
 		UI_DisplayAircopy();
 		break;
+#endif
+#if defined(ENABLE_SPECTRUM)
+	case DISPLAY_SPECTRUM:
+		UI_DisplaySpectrum();
+		break;
 #endif
 	default:
 		break;
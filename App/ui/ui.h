@@ -29,6 +29,9 @@ enum GUI_DisplayType_t {
 	DISPLAY_SCANNER	= 0x03U,
 #if defined(ENABLE_AIRCOPY)
 	DISPLAY_AIRCOPY	= 0x04U,
+#endif
+#if defined(ENABLE_SPECTRUM)
+	DISPLAY_SPECTRUM	= 0x05U,
 #endif
 	DISPLAY_INVALID	= 0xFFU,
 };
@@ -17,8 +17,8 @@
 #include <string.h>
 #include "driver/eeprom.h"
 #include "driver/st7565.h"
-#include <stdio.h>
 #include "helper/battery.h"
+#include "helper/format.h"
 #include "settings.h"
 #include "ui/helper.h"
 #include "ui/welcome.h"
@@ -38,8 +38,11 @@ void UI_DisplayWelcome(void)
 		memset(WelcomeString0, 0, sizeof(WelcomeString0));
 		memset(WelcomeString1, 0, sizeof(WelcomeString1));
 		if (gEeprom.POWER_ON_DISPLAY_MODE == POWER_ON_DISPLAY_MODE_VOLTAGE) {
-			sprintf(WelcomeString0, "VOLTAGE");
-			sprintf(WelcomeString1, "%d.%02dV", gBatteryVoltageAverage / 100, gBatteryVoltageAverage % 100);
+			char *pString;
+
+			strcpy(WelcomeString0, "VOLTAGE");
+			pString = FORMAT_Fixed(WelcomeString1, gBatteryVoltageAverage, 2, 2);
+			FORMAT_String(pString, "V");
 		} else {
 			EEPROM_ReadBuffer(0x0EB0, WelcomeString0, 16);
 			EEPROM_ReadBuffer(0x0EC0, WelcomeString1, 16);
@@ -17,18 +17,20 @@
 
 #include "driver/bk4819.h"
 #include "driver/gpio.h"
+#include "driver/ramfunc.h"
 #include "driver/system.h"
 #include "driver/systick.h"
+#include "helper/fixed.h"
 
-#define _SET_SCN() GPIO_SetOutputPin(GPIO_PIN_BK4819_SCN)
-#define _SET_SCL() GPIO_SetOutputPin(GPIO_PIN_BK4819_SCL)
-#define _SET_SDA() GPIO_SetOutputPin(GPIO_PIN_BK4819_SDA)
+#define _SET_SCN() GPIO_FAST_SET(GPIO_PIN_BK4819_SCN)
+#define _SET_SCL() GPIO_FAST_SET(GPIO_PIN_BK4819_SCL)
+#define _SET_SDA() GPIO_FAST_SET(GPIO_PIN_BK4819_SDA)
 
-#define _RESET_SCN() GPIO_ResetOutputPin(GPIO_PIN_BK4819_SCN)
-#define _RESET_SCL() GPIO_ResetOutputPin(GPIO_PIN_BK4819_SCL)
-#define _RESET_SDA() GPIO_ResetOutputPin(GPIO_PIN_BK4819_SDA)
+#define _RESET_SCN() GPIO_FAST_RESET(GPIO_PIN_BK4819_SCN)
+#define _RESET_SCL() GPIO_FAST_RESET(GPIO_PIN_BK4819_SCL)
+#define _RESET_SDA() GPIO_FAST_RESET(GPIO_PIN_BK4819_SDA)
 
-#define _GET_SDA() GPIO_GetInputPin(GPIO_PIN_BK4819_SDA)
+#define _GET_SDA() GPIO_FAST_GET(GPIO_PIN_BK4819_SDA)
 
 static const uint16_t FSK_RogerTable[7] = {
     0xF1A2,
@@ -84,16 +86,16 @@ void BK4819_Init(void)
     BK4819_WriteRegister(BK4819_REG_3F, 0);
 }
 
-static uint16_t BK4819_ReadU16(void)
+RAMFUNC_BK4819_READ static uint16_t BK4819_ReadU16(void)
 {
     uint8_t i;
     uint16_t Value;
 
     // PORTCON_PORTC_IE = (PORTCON_PORTC_IE & ~PORTCON_PORTC_IE_C2_MASK) | PORTCON_PORTC_IE_C2_BITS_ENABLE;
     // GPIOC->DIR = (GPIOC->DIR & ~GPIO_DIR_2_MASK) | GPIO_DIR_2_BITS_INPUT;
-    GPIO_SetPinDir(GPIO_PIN_BK4819_SDA, GPIO_DIR_INPUT);
+    GPIO_FAST_SET_DIR(GPIO_PIN_BK4819_SDA, GPIO_DIR_INPUT);
 
-    SYSTICK_DelayUs(1);
+    SYSTICK_SpinUs(1);
 
     Value = 0;
     for (i = 0; i < 16; i++)
@@ -103,15 +105,15 @@ static uint16_t BK4819_ReadU16(void)
         Value |= _GET_SDA();
         // GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCL);
         _SET_SCL();
-        SYSTICK_DelayUs(1);
+        SYSTICK_SpinUs(1);
         // GPIO_ClearBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCL);
         _RESET_SCL();
-        SYSTICK_DelayUs(1);
+        SYSTICK_SpinUs(1);
     }
 
     // PORTCON_PORTC_IE = (PORTCON_PORTC_IE & ~PORTCON_PORTC_IE_C2_MASK) | PORTCON_PORTC_IE_C2_BITS_DISABLE;
     // GPIOC->DIR = (GPIOC->DIR & ~GPIO_DIR_2_MASK) | GPIO_DIR_2_BITS_OUTPUT;
-    GPIO_SetPinDir(GPIO_PIN_BK4819_SDA, GPIO_DIR_OUTPUT);
+    GPIO_FAST_SET_DIR(GPIO_PIN_BK4819_SDA, GPIO_DIR_OUTPUT);
 
     return Value;
 }
@@ -124,7 +126,7 @@ uint16_t BK4819_ReadRegister(BK4819_REGISTER_t Register)
     // GPIO_ClearBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCL);
     _SET_SCN();
     _RESET_SCL();
-    SYSTICK_DelayUs(1);
+    SYSTICK_SpinUs(1);
     // GPIO_ClearBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCN);
     _RESET_SCN();
 
@@ -134,7 +136,7 @@ uint16_t BK4819_ReadRegister(BK4819_REGISTER_t Register)
 
     // GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCN);
     _SET_SCN();
-    SYSTICK_DelayUs(1);
+    SYSTICK_SpinUs(1);
     // GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCL);
     // GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SDA);
     _SET_SCL();
@@ -149,16 +151,16 @@ void BK4819_WriteRegister(BK4819_REGISTER_t Register, uint16_t Data)
     // GPIO_ClearBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCL);
     _SET_SCN();
     _RESET_SCL();
-    SYSTICK_DelayUs(1);
+    SYSTICK_SpinUs(1);
     // GPIO_ClearBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCN);
     _RESET_SCN();
     BK4819_WriteU8(Register);
-    SYSTICK_DelayUs(1);
+    SYSTICK_SpinUs(1);
     BK4819_WriteU16(Data);
-    SYSTICK_DelayUs(1);
+    SYSTICK_SpinUs(1);
     // GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCN);
     _SET_SCN();
-    SYSTICK_DelayUs(1);
+    SYSTICK_SpinUs(1);
     // GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCL);
     // GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SDA);
     _SET_SCL();
@@ -183,18 +185,18 @@ void BK4819_WriteU8(uint8_t Data)
             // GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SDA);
             _SET_SDA();
         }
-        SYSTICK_DelayUs(1);
+        SYSTICK_SpinUs(1);
         // GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCL);
         _SET_SCL();
-        SYSTICK_DelayUs(1);
+        SYSTICK_SpinUs(1);
         Data <<= 1;
         // GPIO_ClearBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCL);
         _RESET_SCL();
-        SYSTICK_DelayUs(1);
+        SYSTICK_SpinUs(1);
     }
 }
 
-void BK4819_WriteU16(uint16_t Data)
+RAMFUNC_BK4819_WRITE void BK4819_WriteU16(uint16_t Data)
 {
     uint8_t i;
 
@@ -212,14 +214,14 @@ void BK4819_WriteU16(uint16_t Data)
             // GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SDA);
             _SET_SDA();
         }
-        SYSTICK_DelayUs(1);
+        SYSTICK_SpinUs(1);
         // GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCL);
         _SET_SCL();
         Data <<= 1;
-        SYSTICK_DelayUs(1);
+        SYSTICK_SpinUs(1);
         // GPIO_ClearBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCL);
         _RESET_SCL();
-        SYSTICK_DelayUs(1);
+        SYSTICK_SpinUs(1);
     }
 }
 
@@ -289,6 +291,9 @@ void BK4819_SetCDCSSCodeWord(uint32_t CodeWord)
     BK4819_WriteRegister(BK4819_REG_08, 0x8000 | ((CodeWord >> 12) & 0xFFF));
 }
 
+// 1000, from serialtool/fixed_tables.py
+static const FIXED_Reciprocal_t Ctc1Reciprocal = {0x83126E98U, 41};
+
 void BK4819_SetCTCSSFrequency(uint32_t FreqControlWord)
 {
     uint16_t Config;
@@ -314,7 +319,7 @@ void BK4819_SetCTCSSFrequency(uint32_t FreqControlWord)
     }
     BK4819_WriteRegister(BK4819_REG_51, Config);
     // CTC1 Frequency Control Word
-    BK4819_WriteRegister(BK4819_REG_07, 0 | BK4819_REG_07_MODE_CTC1 | ((FreqControlWord * 2065) / 1000) << BK4819_REG_07_SHIFT_FREQUENCY);
+    BK4819_WriteRegister(BK4819_REG_07, 0 | BK4819_REG_07_MODE_CTC1 | FIXED_Divide(FreqControlWord * 2065, &Ctc1Reciprocal) << BK4819_REG_07_SHIFT_FREQUENCY);
 }
 
 void BK4819_Set55HzTailDetection(void)
@@ -383,6 +388,16 @@ void BK4819_SetFrequency(uint32_t Frequency)
     BK4819_WriteRegister(BK4819_REG_39, (Frequency >> 16) & 0xFFFF);
 }
 
+// Retunes a running receiver with as few register writes as possible:
+// restarting the RX link makes the PLL recalibrate the VCO for the new
+// frequency, everything else (filters, AGC, squelch) is left as it is.
+void BK4819_RetuneRX(uint32_t Frequency)
+{
+    BK4819_SetFrequency(Frequency);
+    BK4819_WriteRegister(BK4819_REG_30, 0);
+    BK4819_WriteRegister(BK4819_REG_30, 0xBFF1);
+}
+
 void BK4819_SetupSquelch(uint8_t SquelchOpenRSSIThresh, uint8_t SquelchCloseRSSIThresh, uint8_t SquelchOpenNoiseThresh, uint8_t SquelchCloseNoiseThresh, uint8_t SquelchCloseGlitchThresh, uint8_t SquelchOpenGlitchThresh)
 {
     BK4819_WriteRegister(BK4819_REG_70, 0);
@@ -509,6 +524,11 @@ void BK4819_PlayTone(uint16_t Frequency, bool bTuningGainSwitch)
     BK4819_WriteRegister(BK4819_REG_30, 0 | BK4819_REG_30_ENABLE_AF_DAC | BK4819_REG_30_ENABLE_DISC_MODE | BK4819_REG_30_ENABLE_TX_DSP);
     ;
 
+    BK4819_SetToneFrequency(Frequency);
+}
+
+void BK4819_SetToneFrequency(uint16_t Frequency)
+{
     BK4819_WriteRegister(BK4819_REG_71, (uint16_t)((Frequency * 1032444) / 100000));
 }
 
@@ -548,6 +568,11 @@ void BK4819_SetupAircopy(void)
     BK4819_WriteRegister(BK4819_REG_5D, 0x4700); // FSK Data Length 72 Bytes (0xabcd + 2 byte length + 64 byte payload + 2 byte CRC + 0xdcba)
 }
 
+void BK4819_SetFSKFrameLength(uint8_t Bytes)
+{
+    BK4819_WriteRegister(BK4819_REG_5D, (uint16_t)(Bytes - 1U) << 8);
+}
+
 void BK4819_ResetFSK(void)
 {
     BK4819_WriteRegister(BK4819_REG_3F, 0x0000); // Disable interrupts
@@ -703,33 +728,6 @@ void BK4819_PlayDTMF(char Code)
     }
 }
 
-void BK4819_PlayDTMFString(const char *pString, bool bDelayFirst, uint16_t FirstCodePersistTime, uint16_t HashCodePersistTime, uint16_t CodePersistTime, uint16_t CodeInternalTime)
-{
-    uint8_t i;
-    uint16_t Delay;
-
-    for (i = 0; pString[i]; i++)
-    {
-        BK4819_PlayDTMF(pString[i]);
-        BK4819_ExitTxMute();
-        if (bDelayFirst && i == 0)
-        {
-            Delay = FirstCodePersistTime;
-        }
-        else if (pString[i] == '*' || pString[i] == '#')
-        {
-            Delay = HashCodePersistTime;
-        }
-        else
-        {
-            Delay = CodePersistTime;
-        }
-        SYSTEM_DelayMs(Delay);
-        BK4819_EnterTxMute();
-        SYSTEM_DelayMs(CodeInternalTime);
-    }
-}
-
 void BK4819_TransmitTone(bool bLocalLoopback, uint32_t Frequency)
 {
     BK4819_EnterTxMute();
@@ -869,43 +867,124 @@ uint8_t BK4819_GetCTCType(void)
 }
 
 #if defined(ENABLE_AIRCOPY)
-void BK4819_SendFSKData(uint16_t *pData)
+// Non-blocking FSK TX. BK4819_PollFSKTx() runs one step per call and is
+// meant to be called every 10 ms; the step lengths below are in calls.
+// The sequence is the one of the old blocking sender: settle, fill the
+// FIFO, settle, transmit until REG_0C bit 0 is set (1 s timeout), settle,
+// reset FSK.
+
+enum
+{
+    _FSK_TX_IDLE = 0,
+    _FSK_TX_FILL,
+    _FSK_TX_START,
+    _FSK_TX_WAIT,
+    _FSK_TX_STOP,
+    _FSK_TX_RESET,
+};
+
+static struct
 {
-    uint8_t i;
-    uint8_t Timeout;
+    const uint16_t *pData;
+    uint8_t Size;
+    uint8_t State;
+    uint8_t Countdown;
+} _FskTx;
 
-    Timeout = 200;
+void BK4819_StartFSKTx(const uint16_t *pData, uint8_t Size)
+{
+    _FskTx.pData = pData;
+    _FskTx.Size = Size;
+    _FskTx.State = _FSK_TX_FILL;
+    // Not aligned to the poll period: one more for a full 20 ms
+    _FskTx.Countdown = 3;
+}
 
-    SYSTEM_DelayMs(20);
+bool BK4819_IsFSKTxBusy(void)
+{
+    return _FskTx.State != _FSK_TX_IDLE;
+}
 
-    BK4819_WriteRegister(BK4819_REG_3F, BK4819_REG_3F_FSK_TX_FINISHED);
-    BK4819_WriteRegister(BK4819_REG_59, 0x8068);
-    BK4819_WriteRegister(BK4819_REG_59, 0x0068);
+bool BK4819_PollFSKTx(void)
+{
+    uint8_t i;
 
-    for (i = 0; i < 36; i++)
+    if (_FskTx.Countdown && --_FskTx.Countdown)
     {
-        BK4819_WriteRegister(BK4819_REG_5F, pData[i]);
+        // The TX finished flag is checked on every call
+        if (_FskTx.State != _FSK_TX_WAIT || (BK4819_ReadRegister(BK4819_REG_0C) & 1U) == 0)
+        {
+            return true;
+        }
     }
 
-    SYSTEM_DelayMs(20);
-
-    BK4819_WriteRegister(BK4819_REG_59, 0x2868);
-
-    while (Timeout)
+    switch (_FskTx.State)
     {
-        if (BK4819_ReadRegister(BK4819_REG_0C) & 1U)
+    case _FSK_TX_FILL:
+        BK4819_WriteRegister(BK4819_REG_3F, BK4819_REG_3F_FSK_TX_FINISHED);
+        BK4819_WriteRegister(BK4819_REG_59, 0x8068);
+        BK4819_WriteRegister(BK4819_REG_59, 0x0068);
+        for (i = 0; i < _FskTx.Size; i++)
         {
-            break;
+            BK4819_WriteRegister(BK4819_REG_5F, _FskTx.pData[i]);
         }
-        SYSTEM_DelayMs(5);
-        Timeout--;
+        _FskTx.State = _FSK_TX_START;
+        _FskTx.Countdown = 2;
+        break;
+
+    case _FSK_TX_START:
+        BK4819_WriteRegister(BK4819_REG_59, 0x2868);
+        _FskTx.State = _FSK_TX_WAIT;
+        _FskTx.Countdown = 100;
+        break;
+
+    case _FSK_TX_WAIT:
+        // Finished or timed out
+        BK4819_WriteRegister(BK4819_REG_02, 0);
+        _FskTx.State = _FSK_TX_STOP;
+        _FskTx.Countdown = 2;
+        break;
+
+    case _FSK_TX_STOP:
+        // BK4819_ResetFSK() without the blocking delay
+        BK4819_WriteRegister(BK4819_REG_3F, 0x0000);
+        BK4819_WriteRegister(BK4819_REG_59, 0x0068);
+        _FskTx.State = _FSK_TX_RESET;
+        _FskTx.Countdown = 3;
+        break;
+
+    case _FSK_TX_RESET:
+        BK4819_Idle();
+        _FskTx.State = _FSK_TX_IDLE;
+        break;
+
+    default:
+        break;
     }
 
+    return _FskTx.State != _FSK_TX_IDLE;
+}
+
+void BK4819_AbortFSKTx(void)
+{
+    if (_FskTx.State == _FSK_TX_IDLE)
+    {
+        return;
+    }
     BK4819_WriteRegister(BK4819_REG_02, 0);
-    SYSTEM_DelayMs(20);
+    _FskTx.State = _FSK_TX_IDLE;
     BK4819_ResetFSK();
 }
 
+void BK4819_SendFSKData(uint16_t *pData)
+{
+    BK4819_StartFSKTx(pData, 36);
+    while (BK4819_PollFSKTx())
+    {
+        SYSTEM_DelayMs(10);
+    }
+}
+
 void BK4819_PrepareFSKReceive(void)
 {
     BK4819_ResetFSK();
@@ -67,6 +67,7 @@ void BK4819_EnableVox(uint16_t Vox1Threshold, uint16_t Vox0Threshold);
 void BK4819_SetFilterBandwidth(BK4819_FilterBandwidth_t Bandwidth);
 void BK4819_SetupPowerAmplifier(uint16_t Bias, uint32_t Frequency);
 void BK4819_SetFrequency(uint32_t Frequency);
+void BK4819_RetuneRX(uint32_t Frequency);
 void BK4819_SetupSquelch(
 		uint8_t SquelchOpenRSSIThresh, uint8_t SquelchCloseRSSIThresh,
 		uint8_t SquelchOpenNoiseThresh, uint8_t SquelchCloseNoiseThresh,
@@ -81,11 +82,13 @@ void BK4819_DisableVox(void);
 void BK4819_DisableDTMF(void);
 void BK4819_EnableDTMF(void);
 void BK4819_PlayTone(uint16_t Frequency, bool bTuningGainSwitch);
+void BK4819_SetToneFrequency(uint16_t Frequency);
 void BK4819_EnterTxMute(void);
 void BK4819_ExitTxMute(void);
 void BK4819_Sleep(void);
 void BK4819_TurnsOffTones_TurnsOnRX(void);
 void BK4819_SetupAircopy(void);
+void BK4819_SetFSKFrameLength(uint8_t Bytes);
 void BK4819_ResetFSK(void);
 void BK4819_Idle(void);
 void BK4819_ExitBypass(void);
@@ -100,7 +103,6 @@ void BK4819_ExitDTMF_TX(bool bKeep);
 void BK4819_EnableTXLink(void);
 
 void BK4819_PlayDTMF(char Code);
-void BK4819_PlayDTMFString(const char *pString, bool bDelayFirst, uint16_t FirstCodePersistTime, uint16_t HashCodePersistTime, uint16_t CodePersistTime, uint16_t CodeInternalTime);
 
 void BK4819_TransmitTone(bool bLocalLoopback, uint32_t Frequency);
 
@@ -125,6 +127,10 @@ uint8_t BK4819_GetDTMF_5TONE_Code(void);
 uint8_t BK4819_GetCDCSSCodeType(void);
 uint8_t BK4819_GetCTCType(void);
 
+void BK4819_StartFSKTx(const uint16_t *pData, uint8_t Size);
+bool BK4819_IsFSKTxBusy(void);
+bool BK4819_PollFSKTx(void);
+void BK4819_AbortFSKTx(void);
 void BK4819_SendFSKData(uint16_t *pData);
 void BK4819_PrepareFSKReceive(void);
 
@@ -22,6 +22,7 @@
 #include <stdint.h>
 
 void BOARD_ADC_GetBatteryInfo(uint16_t *pVoltage, uint16_t *pCurrent);
+void BOARD_ADC_GetBatteryAverage(uint16_t *pVoltage, uint16_t *pCurrent);
 void BOARD_Init(void);
 
 #endif
@@ -18,8 +18,30 @@
 #include "driver/i2c.h"
 #include "driver/system.h"
 
+// A little above the 10 ms EEPROM_WriteBuffer() allows a write cycle
+#define EEPROM_WRITE_TIMEOUT_MS	12U
+
+static bool gEepromWriting;
+
+static void EEPROM_WaitIdle(void)
+{
+	uint8_t i;
+
+	for (i = 0; i < EEPROM_WRITE_TIMEOUT_MS; i++) {
+		if (!EEPROM_IsBusy()) {
+			return;
+		}
+		SYSTEM_DelayMs(1);
+	}
+
+	// No ACK at all, a bus fault: give up rather than hang every access
+	gEepromWriting = false;
+}
+
 void EEPROM_ReadBuffer(uint16_t Address, void *pBuffer, uint8_t Size)
 {
+	EEPROM_WaitIdle();
+
 	I2C_Start();
 
 	I2C_Write(0xA0);
@@ -39,6 +61,8 @@ void EEPROM_ReadBuffer(uint16_t Address, void *pBuffer, uint8_t Size)
 void EEPROM_WriteBuffer(uint16_t Address, const void *pBuffer)
 
 {
+	EEPROM_WaitIdle();
+
 	I2C_Start();
 
 	I2C_Write(0xA0);
@@ -53,3 +77,39 @@ void EEPROM_WriteBuffer(uint16_t Address, const void *pBuffer)
 	SYSTEM_DelayMs(10);
 }
 
+
+void EEPROM_StartWrite(uint16_t Address, const void *pBuffer, uint8_t Size)
+{
+	EEPROM_WaitIdle();
+
+	I2C_Start();
+
+	I2C_Write(0xA0);
+
+	I2C_Write((Address >> 8) & 0xFF);
+	I2C_Write((Address >> 0) & 0xFF);
+
+	I2C_WriteBuffer(pBuffer, Size);
+
+	I2C_Stop();
+
+	gEepromWriting = true;
+}
+
+bool EEPROM_IsBusy(void)
+{
+	bool bBusy;
+
+	if (!gEepromWriting) {
+		return false;
+	}
+
+	// The chip doesn't ACK its address until the write cycle is over
+	I2C_Start();
+	bBusy = I2C_Write(0xA0) < 0;
+	I2C_Stop();
+
+	gEepromWriting = bBusy;
+
+	return bBusy;
+}
@@ -17,10 +17,18 @@
 #ifndef DRIVER_EEPROM_H
 #define DRIVER_EEPROM_H
 
+#include <stdbool.h>
 #include <stdint.h>
 
+#define EEPROM_PAGE_SIZE	32U
+
 void EEPROM_ReadBuffer(uint16_t Address, void *pBuffer, uint8_t Size);
 void EEPROM_WriteBuffer(uint16_t Address, const void *pBuffer);
 
+// Starts a write of up to one page without waiting for the write cycle.
+// The range must not cross a page boundary.
+void EEPROM_StartWrite(uint16_t Address, const void *pBuffer, uint8_t Size);
+bool EEPROM_IsBusy(void);
+
 #endif
 
@@ -66,4 +66,20 @@ static inline void GPIO_ResetAudioPath() { GPIO_ResetOutputPin(GPIO_PIN_AUDIO_PA
 static inline void GPIO_SetBacklight() { GPIO_SetOutputPin(GPIO_PIN_BACKLIGHT); }
 static inline void GPIO_ResetBacklight() { GPIO_ResetOutputPin(GPIO_PIN_BACKLIGHT); }
 
+// Statically resolved pin access for hot paths (bit-banged buses, keypad
+// scan). `Pin` must be a literal GPIO_PIN_* name: the port and pin number
+// come from the board's gpio-pins.h, so each call is a single register
+// access with no table lookup or call.
+
+#if defined(K5_V1)
+#include "v1/gpio-pins.h"
+#elif defined(K5_V2)
+#include "v2/gpio-pins.h"
+#endif
+
+#define GPIO_FAST_SET(Pin) GPIO_PortSetPin(Pin##_PORT, Pin##_NUM)
+#define GPIO_FAST_RESET(Pin) GPIO_PortResetPin(Pin##_PORT, Pin##_NUM)
+#define GPIO_FAST_GET(Pin) GPIO_PortGetPin(Pin##_PORT, Pin##_NUM)
+#define GPIO_FAST_SET_DIR(Pin, Dir) GPIO_PortSetPinDir(Pin##_PORT, Pin##_NUM, Dir)
+
 #endif
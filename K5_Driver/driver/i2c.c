@@ -17,67 +17,68 @@
 
 #include "driver/gpio.h"
 #include "driver/i2c.h"
+#include "driver/ramfunc.h"
 #include "driver/systick.h"
 
-#define _SET_SDA() GPIO_SetOutputPin(GPIO_PIN_I2C_SDA)
-#define _RESET_SDA() GPIO_ResetOutputPin(GPIO_PIN_I2C_SDA)
-#define _GET_SDA() GPIO_GetInputPin(GPIO_PIN_I2C_SDA)
+#define _SET_SDA() GPIO_FAST_SET(GPIO_PIN_I2C_SDA)
+#define _RESET_SDA() GPIO_FAST_RESET(GPIO_PIN_I2C_SDA)
+#define _GET_SDA() GPIO_FAST_GET(GPIO_PIN_I2C_SDA)
 
-#define _SET_SCL() GPIO_SetOutputPin(GPIO_PIN_I2C_SCL)
-#define _RESET_SCL() GPIO_ResetOutputPin(GPIO_PIN_I2C_SCL)
+#define _SET_SCL() GPIO_FAST_SET(GPIO_PIN_I2C_SCL)
+#define _RESET_SCL() GPIO_FAST_RESET(GPIO_PIN_I2C_SCL)
 
 void I2C_Start(void)
 {
     // GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_I2C_SDA);
     _SET_SDA();
-    SYSTICK_DelayUs(1);
+    SYSTICK_SpinUs(1);
     // GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_I2C_SCL);
     _SET_SCL();
-    SYSTICK_DelayUs(1);
+    SYSTICK_SpinUs(1);
     // GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_I2C_SDA);
     _RESET_SDA();
-    SYSTICK_DelayUs(1);
+    SYSTICK_SpinUs(1);
     // GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_I2C_SCL);
     _RESET_SCL();
-    SYSTICK_DelayUs(1);
+    SYSTICK_SpinUs(1);
 }
 
 void I2C_Stop(void)
 {
     // GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_I2C_SDA);
     _RESET_SDA();
-    SYSTICK_DelayUs(1);
+    SYSTICK_SpinUs(1);
     // GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_I2C_SCL);
     _RESET_SCL();
-    SYSTICK_DelayUs(1);
+    SYSTICK_SpinUs(1);
     // GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_I2C_SCL);
     _SET_SCL();
-    SYSTICK_DelayUs(1);
+    SYSTICK_SpinUs(1);
     // GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_I2C_SDA);
     _SET_SDA();
-    SYSTICK_DelayUs(1);
+    SYSTICK_SpinUs(1);
 }
 
-uint8_t I2C_Read(bool bFinal)
+RAMFUNC_I2C_READ uint8_t I2C_Read(bool bFinal)
 {
     uint8_t i, Data;
 
     // PORTCON_PORTA_IE |= PORTCON_PORTA_IE_A11_BITS_ENABLE;
     // PORTCON_PORTA_OD &= ~PORTCON_PORTA_OD_A11_MASK;
     // GPIOA->DIR &= ~GPIO_DIR_11_MASK;
-    GPIO_SetPinDir(GPIO_PIN_I2C_SDA, GPIO_DIR_INPUT);
+    GPIO_FAST_SET_DIR(GPIO_PIN_I2C_SDA, GPIO_DIR_INPUT);
 
     Data = 0;
     for (i = 0; i < 8; i++)
     {
         // GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_I2C_SCL);
         _RESET_SCL();
-        SYSTICK_DelayUs(1);
+        SYSTICK_SpinUs(1);
         // GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_I2C_SCL);
         _SET_SCL();
-        SYSTICK_DelayUs(1);
+        SYSTICK_SpinUs(1);
         Data <<= 1;
-        SYSTICK_DelayUs(1);
+        SYSTICK_SpinUs(1);
         // if (GPIO_CheckBit(&GPIOA->DATA, GPIOA_PIN_I2C_SDA))
         if (_GET_SDA())
         {
@@ -85,17 +86,17 @@ uint8_t I2C_Read(bool bFinal)
         }
         // GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_I2C_SCL);
         _RESET_SCL();
-        SYSTICK_DelayUs(1);
+        SYSTICK_SpinUs(1);
     }
 
     // PORTCON_PORTA_IE &= ~PORTCON_PORTA_IE_A11_MASK;
     // PORTCON_PORTA_OD |= PORTCON_PORTA_OD_A11_BITS_ENABLE;
     // GPIOA->DIR |= GPIO_DIR_11_BITS_OUTPUT;
-    GPIO_SetPinDir(GPIO_PIN_I2C_SDA, GPIO_DIR_OUTPUT);
+    GPIO_FAST_SET_DIR(GPIO_PIN_I2C_SDA, GPIO_DIR_OUTPUT);
 
     // GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_I2C_SCL);
     _RESET_SCL();
-    SYSTICK_DelayUs(1);
+    SYSTICK_SpinUs(1);
     if (bFinal)
     {
         // GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_I2C_SDA);
@@ -106,25 +107,25 @@ uint8_t I2C_Read(bool bFinal)
         // GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_I2C_SDA);
         _RESET_SDA();
     }
-    SYSTICK_DelayUs(1);
+    SYSTICK_SpinUs(1);
     // GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_I2C_SCL);
     _SET_SCL();
-    SYSTICK_DelayUs(1);
+    SYSTICK_SpinUs(1);
     // GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_I2C_SCL);
     _RESET_SCL();
-    SYSTICK_DelayUs(1);
+    SYSTICK_SpinUs(1);
 
     return Data;
 }
 
-int I2C_Write(uint8_t Data)
+RAMFUNC_I2C_WRITE int I2C_Write(uint8_t Data)
 {
     uint8_t i;
     int ret = -1;
 
     // GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_I2C_SCL);
     _RESET_SCL();
-    SYSTICK_DelayUs(1);
+    SYSTICK_SpinUs(1);
     for (i = 0; i < 8; i++)
     {
         if ((Data & 0x80) == 0)
@@ -138,26 +139,26 @@ int I2C_Write(uint8_t Data)
             _SET_SDA();
         }
         Data <<= 1;
-        SYSTICK_DelayUs(1);
+        SYSTICK_SpinUs(1);
         // GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_I2C_SCL);
         _SET_SCL();
-        SYSTICK_DelayUs(1);
+        SYSTICK_SpinUs(1);
         // GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_I2C_SCL);
         _RESET_SCL();
-        SYSTICK_DelayUs(1);
+        SYSTICK_SpinUs(1);
     }
 
     // PORTCON_PORTA_IE |= PORTCON_PORTA_IE_A11_BITS_ENABLE;
     // PORTCON_PORTA_OD &= ~PORTCON_PORTA_OD_A11_MASK;
     // GPIOA->DIR &= ~GPIO_DIR_11_MASK;
-    GPIO_SetPinDir(GPIO_PIN_I2C_SDA, GPIO_DIR_INPUT);
+    GPIO_FAST_SET_DIR(GPIO_PIN_I2C_SDA, GPIO_DIR_INPUT);
 
     // GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_I2C_SDA);
     _SET_SDA();
-    SYSTICK_DelayUs(1);
+    SYSTICK_SpinUs(1);
     // GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_I2C_SCL);
     _SET_SCL();
-    SYSTICK_DelayUs(1);
+    SYSTICK_SpinUs(1);
 
     for (i = 0; i < 255; i++)
     {
@@ -171,11 +172,11 @@ int I2C_Write(uint8_t Data)
 
     // GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_I2C_SCL);
     _RESET_SCL();
-    SYSTICK_DelayUs(1);
+    SYSTICK_SpinUs(1);
     // PORTCON_PORTA_IE &= ~PORTCON_PORTA_IE_A11_MASK;
     // PORTCON_PORTA_OD |= PORTCON_PORTA_OD_A11_BITS_ENABLE;
     // GPIOA->DIR |= GPIO_DIR_11_BITS_OUTPUT;
-    GPIO_SetPinDir(GPIO_PIN_I2C_SDA, GPIO_DIR_OUTPUT);
+    GPIO_FAST_SET_DIR(GPIO_PIN_I2C_SDA, GPIO_DIR_OUTPUT);
 
     // GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_I2C_SDA);
     _SET_SDA();
@@ -196,11 +197,11 @@ int I2C_ReadBuffer(void *pBuffer, uint8_t Size)
 
     for (i = 0; i < Size - 1; i++)
     {
-        SYSTICK_DelayUs(1);
+        SYSTICK_SpinUs(1);
         pData[i] = I2C_Read(false);
     }
 
-    SYSTICK_DelayUs(1);
+    SYSTICK_SpinUs(1);
     pData[i++] = I2C_Read(true);
 
     return Size;
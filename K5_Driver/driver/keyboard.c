@@ -20,14 +20,15 @@
 #include "driver/keyboard.h"
 #include "driver/systick.h"
 
-#define _SET_KB_PIN(n) GPIO_SetOutputPin(GPIO_PIN_KEYBOARD_##n)
-#define _RESET_KB_PIN(n) GPIO_ResetOutputPin(GPIO_PIN_KEYBOARD_##n)
-#define _GET_KB_PIN(n) GPIO_GetInputPin(GPIO_PIN_KEYBOARD_##n)
+#define _SET_KB_PIN(n) GPIO_FAST_SET(GPIO_PIN_KEYBOARD_##n)
+#define _RESET_KB_PIN(n) GPIO_FAST_RESET(GPIO_PIN_KEYBOARD_##n)
+#define _GET_KB_PIN(n) GPIO_FAST_GET(GPIO_PIN_KEYBOARD_##n)
 
 KEY_Code_t gKeyReading0 = KEY_INVALID;
 KEY_Code_t gKeyReading1 = KEY_INVALID;
 uint16_t gDebounceCounter;
 bool gWasFKeyPressed;
+volatile bool gKeyboardWakePending;
 
 KEY_Code_t KEYBOARD_Poll(void)
 {
@@ -42,7 +43,7 @@ KEY_Code_t KEYBOARD_Poll(void)
     _SET_KB_PIN(6);
     _SET_KB_PIN(7);
 
-    SYSTICK_DelayUs(1);
+    SYSTICK_SpinUs(1);
 
     // Keys connected to gnd
     // if (!GPIO_CheckBit(&GPIOA->DATA, GPIOA_PIN_KEYBOARD_0))
@@ -62,7 +63,7 @@ KEY_Code_t KEYBOARD_Poll(void)
     // First row
     // GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_KEYBOARD_4);
     _RESET_KB_PIN(4);
-    SYSTICK_DelayUs(1);
+    SYSTICK_SpinUs(1);
 
     // if (!GPIO_CheckBit(&GPIOA->DATA, GPIOA_PIN_KEYBOARD_0))
     if (!_GET_KB_PIN(0))
@@ -92,11 +93,11 @@ KEY_Code_t KEYBOARD_Poll(void)
     // Second row
     // GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_KEYBOARD_5);
     _RESET_KB_PIN(5);
-    SYSTICK_DelayUs(1);
+    SYSTICK_SpinUs(1);
 
     // GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_KEYBOARD_4);
     _SET_KB_PIN(4);
-    SYSTICK_DelayUs(1);
+    SYSTICK_SpinUs(1);
 
     // if (!GPIO_CheckBit(&GPIOA->DATA, GPIOA_PIN_KEYBOARD_0))
     if (!_GET_KB_PIN(0))
@@ -126,19 +127,19 @@ KEY_Code_t KEYBOARD_Poll(void)
     // Third row
     // GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_KEYBOARD_4);
     _RESET_KB_PIN(4);
-    SYSTICK_DelayUs(1);
+    SYSTICK_SpinUs(1);
 
     // GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_KEYBOARD_5);
     _SET_KB_PIN(5);
-    SYSTICK_DelayUs(1);
+    SYSTICK_SpinUs(1);
 
     // GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_KEYBOARD_4);
     _SET_KB_PIN(4);
-    SYSTICK_DelayUs(1);
+    SYSTICK_SpinUs(1);
 
     // GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_KEYBOARD_6);
     _RESET_KB_PIN(6);
-    SYSTICK_DelayUs(1);
+    SYSTICK_SpinUs(1);
 
     // if (!GPIO_CheckBit(&GPIOA->DATA, GPIOA_PIN_KEYBOARD_0))
     if (!_GET_KB_PIN(0))
@@ -168,11 +169,11 @@ KEY_Code_t KEYBOARD_Poll(void)
     // Fourth row
     // GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_KEYBOARD_7);
     _RESET_KB_PIN(7);
-    SYSTICK_DelayUs(1);
+    SYSTICK_SpinUs(1);
 
     // GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_KEYBOARD_6);
     _SET_KB_PIN(6);
-    SYSTICK_DelayUs(1);
+    SYSTICK_SpinUs(1);
 
     // if (!GPIO_CheckBit(&GPIOA->DATA, GPIOA_PIN_KEYBOARD_0))
     if (!_GET_KB_PIN(0))
@@ -211,3 +212,25 @@ Bye:
 
     return Key;
 }
+
+void KEYBOARD_ParkRows(void)
+{
+    // SCL (row 4) goes low before SDA (row 5), so the I2C devices never
+    // see a START condition
+    _RESET_KB_PIN(4);
+    _RESET_KB_PIN(5);
+    _RESET_KB_PIN(6);
+    _RESET_KB_PIN(7);
+}
+
+bool KEYBOARD_IsAnyKeyDown(void)
+{
+    // With every row low, any pressed key (matrix or side key) pulls its
+    // column low, so four pin reads replace the full matrix scan.
+    // The rows are left parked: a key pressed later pulls a column low,
+    // which the board may turn into a wake interrupt (gKeyboardWakePending).
+    KEYBOARD_ParkRows();
+    SYSTICK_SpinUs(1);
+
+    return !_GET_KB_PIN(0) || !_GET_KB_PIN(1) || !_GET_KB_PIN(2) || !_GET_KB_PIN(3);
+}
@@ -50,8 +50,11 @@ extern KEY_Code_t gKeyReading0;
 extern KEY_Code_t gKeyReading1;
 extern uint16_t gDebounceCounter;
 extern bool gWasFKeyPressed;
+extern volatile bool gKeyboardWakePending;
 
 KEY_Code_t KEYBOARD_Poll(void);
+void KEYBOARD_ParkRows(void);
+bool KEYBOARD_IsAnyKeyDown(void);
 
 #endif
 
@@ -0,0 +1,71 @@
+/* Copyright 2025 muzkr https://github.com/muzkr
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#ifndef DRIVER_RAMFUNC_H
+#define DRIVER_RAMFUNC_H
+
+// Opt-in execution of hot functions from SRAM (V2 only).
+//
+// A function marked RAMFUNC goes to the .ramfunc section, which the V2 linker
+// script places in .data, so the startup code copies it to RAM together with
+// the initialized data. Calls between flash and RAM are out of BL range; the
+// linker inserts long-branch veneers for them.
+//
+// RAM is only 8 KB, so every candidate has its own switch (ENABLE_RAMFUNC_*,
+// see Core/v2/CMakeLists.txt) and stays in flash unless enabled.
+
+#if defined(K5_V2)
+#define RAMFUNC __attribute__((section(".ramfunc"), noinline))
+#else
+#define RAMFUNC
+#endif
+
+#if defined(ENABLE_RAMFUNC_SYSTICK)
+#define RAMFUNC_SYSTICK RAMFUNC
+#else
+#define RAMFUNC_SYSTICK
+#endif
+
+#if defined(ENABLE_RAMFUNC_BK4819_WRITE)
+#define RAMFUNC_BK4819_WRITE RAMFUNC
+#else
+#define RAMFUNC_BK4819_WRITE
+#endif
+
+#if defined(ENABLE_RAMFUNC_BK4819_READ)
+#define RAMFUNC_BK4819_READ RAMFUNC
+#else
+#define RAMFUNC_BK4819_READ
+#endif
+
+#if defined(ENABLE_RAMFUNC_I2C_READ)
+#define RAMFUNC_I2C_READ RAMFUNC
+#else
+#define RAMFUNC_I2C_READ
+#endif
+
+#if defined(ENABLE_RAMFUNC_I2C_WRITE)
+#define RAMFUNC_I2C_WRITE RAMFUNC
+#else
+#define RAMFUNC_I2C_WRITE
+#endif
+
+#if defined(ENABLE_RAMFUNC_ST7565_WRITE)
+#define RAMFUNC_ST7565_WRITE RAMFUNC
+#else
+#define RAMFUNC_ST7565_WRITE
+#endif
+
+#endif
@@ -22,6 +22,8 @@
 // 0x20000324
 static uint32_t gTickMultiplier;
 
+uint32_t gSysTickSpinLoopsPerUs;
+
 void SYSTICK_Init(void)
 {
     // SysTick_Config(480000);
@@ -29,6 +31,7 @@ void SYSTICK_Init(void)
 
     SysTick_Config(SystemCoreClock / 100); // interrupt interval 1/100 s = 10 ms
     gTickMultiplier = SystemCoreClock / 1000000;
+    gSysTickSpinLoopsPerUs = (SystemCoreClock + (1000000 * SYSTICK_SPIN_LOOP_CYCLES - 1)) / (1000000 * SYSTICK_SPIN_LOOP_CYCLES);
 
     NVIC_SetPriority(SysTick_IRQn, 3);
     NVIC_EnableIRQ(SysTick_IRQn);
@@ -19,8 +19,45 @@
 
 #include <stdint.h>
 
+// CPU cycles spent per iteration of the SYSTICK_SpinLoops() loop:
+// `subs` (1) + taken `bne` (3 on Cortex-M0, 2 on Cortex-M0+)
+#if defined(K5_V1)
+#define SYSTICK_SPIN_LOOP_CYCLES 4U
+#else
+#define SYSTICK_SPIN_LOOP_CYCLES 3U
+#endif
+
+// Spin loop iterations per microsecond at the current SystemCoreClock,
+// rounded up. Set by SYSTICK_Init().
+extern uint32_t gSysTickSpinLoopsPerUs;
+
 void SYSTICK_Init(void);
 void SYSTICK_DelayUs(uint32_t Delay);
 
+// Busy-waits for (at least) `Loops * SYSTICK_SPIN_LOOP_CYCLES` CPU cycles.
+// Flash wait states can only make it longer.
+static inline __attribute__((always_inline)) void SYSTICK_SpinLoops(uint32_t Loops)
+{
+    if (Loops == 0)
+    {
+        return;
+    }
+
+    __asm volatile(
+        "1: subs %0, %0, #1 \n"
+        "   bne 1b         \n"
+        : "+l"(Loops)
+        :
+        : "cc");
+}
+
+// Short delay for bit-banged buses. Unlike SYSTICK_DelayUs() it does not
+// poll SysTick and is inlined at the call site, so a constant `Delay` folds
+// into the loop count. Use SYSTICK_DelayUs() / SYSTEM_DelayMs() for long delays.
+static inline __attribute__((always_inline)) void SYSTICK_SpinUs(uint32_t Delay)
+{
+    SYSTICK_SpinLoops(Delay * gSysTickSpinLoopsPerUs);
+}
+
 #endif
 
@@ -0,0 +1,40 @@
+/* Copyright 2025 muzkr https://github.com/muzkr
+ * Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#ifndef DRIVER_VOICE_H
+#define DRIVER_VOICE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Voice chip clip select over GPIO_PIN_VOICE_0 (clock) / GPIO_PIN_VOICE_1
+// (data): a 20 ms start pulse, then 8 bits MSB first, each bit set up 1 ms
+// before a 1.2 ms clock pulse followed by 0.2 ms low.
+//
+// The pins are shared with keyboard rows 6 / 7, so the keypad must not be
+// scanned while VOICE_IsBusy().
+
+void VOICE_Init(void);
+
+// Starts sending `VoiceID`, waiting for a previous ID to finish first.
+// Returns once the ID is sent where the board can't send it in the background.
+void VOICE_Send(uint8_t VoiceID);
+
+bool VOICE_IsBusy(void);
+
+#endif
+
@@ -37,6 +37,7 @@
 #include "driver/system.h"
 #include "driver/st7565.h"
 #include "driver/systick.h"
+#include "driver/voice.h"
 #include "driver/device.h"
 #include "frequencies.h"
 #include "helper/battery.h"
@@ -463,6 +464,31 @@ void BOARD_ADC_GetBatteryInfo(uint16_t *pVoltage, uint16_t *pCurrent)
     *pCurrent = ADC_GetValue(ADC_CH9);
 }
 
+// No background sampling on the DP32: take one conversion per call and
+// average the voltage over the last 4 calls
+void BOARD_ADC_GetBatteryAverage(uint16_t *pVoltage, uint16_t *pCurrent)
+{
+    static uint16_t Voltages[4];
+    static uint8_t Index;
+    static bool bPrimed;
+    uint16_t Voltage;
+    uint8_t i;
+
+    BOARD_ADC_GetBatteryInfo(&Voltage, pCurrent);
+    if (!bPrimed)
+    {
+        for (i = 0; i < 4; i++)
+        {
+            Voltages[i] = Voltage;
+        }
+        bPrimed = true;
+    }
+    Voltages[Index] = Voltage;
+    Index = (Index + 1) & 3;
+
+    *pVoltage = (Voltages[0] + Voltages[1] + Voltages[2] + Voltages[3]) / 4;
+}
+
 void BOARD_Init(void)
 {
     // Enable clock gating of blocks we need.
@@ -485,6 +511,7 @@ void BOARD_Init(void)
     BOARD_GPIO_Init();
     BOARD_ADC_Init();
     ST7565_Init();
+    VOICE_Init();
 #if defined(ENABLE_FMRADIO)
     BK1080_Init(0, false);
 #endif
@@ -0,0 +1,108 @@
+/* Copyright 2025 muzkr https://github.com/muzkr
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#ifndef DRIVER_V1_GPIO_PINS_H
+#define DRIVER_V1_GPIO_PINS_H
+
+#include <stdint.h>
+#include "bsp/dp32g030/gpio.h"
+#include "bsp/dp32g030/portcon.h"
+
+// Board pin assignment: port index (0 = A, 1 = B, 2 = C) and pin number.
+// _PinMappings[] in v1/gpio.c is built from the same definitions.
+
+#define GPIO_PIN_KEYBOARD_0_PORT 0
+#define GPIO_PIN_KEYBOARD_0_NUM 3
+#define GPIO_PIN_KEYBOARD_1_PORT 0
+#define GPIO_PIN_KEYBOARD_1_NUM 4
+#define GPIO_PIN_KEYBOARD_2_PORT 0
+#define GPIO_PIN_KEYBOARD_2_NUM 5
+#define GPIO_PIN_KEYBOARD_3_PORT 0
+#define GPIO_PIN_KEYBOARD_3_NUM 6
+#define GPIO_PIN_KEYBOARD_4_PORT 0
+#define GPIO_PIN_KEYBOARD_4_NUM 10
+#define GPIO_PIN_KEYBOARD_5_PORT 0
+#define GPIO_PIN_KEYBOARD_5_NUM 11
+#define GPIO_PIN_KEYBOARD_6_PORT 0
+#define GPIO_PIN_KEYBOARD_6_NUM 12
+#define GPIO_PIN_KEYBOARD_7_PORT 0
+#define GPIO_PIN_KEYBOARD_7_NUM 13
+#define GPIO_PIN_BACKLIGHT_PORT 1
+#define GPIO_PIN_BACKLIGHT_NUM 6
+#define GPIO_PIN_ST7565_A0_PORT 1
+#define GPIO_PIN_ST7565_A0_NUM 9
+#define GPIO_PIN_ST7565_RES_PORT 1
+#define GPIO_PIN_ST7565_RES_NUM 11
+// GPIO_PIN_ST7565_CS / SCLK / SDA: not used, the LCD is on SPI0
+#define GPIO_PIN_BK1080_PORT 1
+#define GPIO_PIN_BK1080_NUM 15
+#define GPIO_PIN_BK4819_SCN_PORT 2
+#define GPIO_PIN_BK4819_SCN_NUM 0
+#define GPIO_PIN_BK4819_SCL_PORT 2
+#define GPIO_PIN_BK4819_SCL_NUM 1
+#define GPIO_PIN_BK4819_SDA_PORT 2
+#define GPIO_PIN_BK4819_SDA_NUM 2
+#define GPIO_PIN_FLASHLIGHT_PORT 2
+#define GPIO_PIN_FLASHLIGHT_NUM 3
+#define GPIO_PIN_AUDIO_PATH_PORT 2
+#define GPIO_PIN_AUDIO_PATH_NUM 4
+#define GPIO_PIN_PTT_PORT 2
+#define GPIO_PIN_PTT_NUM 5
+
+#define GPIO_PIN_I2C_SCL_PORT GPIO_PIN_KEYBOARD_4_PORT
+#define GPIO_PIN_I2C_SCL_NUM GPIO_PIN_KEYBOARD_4_NUM
+#define GPIO_PIN_I2C_SDA_PORT GPIO_PIN_KEYBOARD_5_PORT
+#define GPIO_PIN_I2C_SDA_NUM GPIO_PIN_KEYBOARD_5_NUM
+#define GPIO_PIN_VOICE_0_PORT GPIO_PIN_KEYBOARD_6_PORT
+#define GPIO_PIN_VOICE_0_NUM GPIO_PIN_KEYBOARD_6_NUM
+#define GPIO_PIN_VOICE_1_PORT GPIO_PIN_KEYBOARD_7_PORT
+#define GPIO_PIN_VOICE_1_NUM GPIO_PIN_KEYBOARD_7_NUM
+
+#define GPIO_PORT_BANK(Port) ((volatile GPIO_Bank_t *)(uintptr_t)(GPIOA_BASE_ADDR + (Port) * GPIOA_BASE_SIZE))
+#define GPIO_PORT_IE(Port) ((volatile uint32_t *)(uintptr_t)(PORTCON_PORTA_IE_ADDR + 4U * (Port)))
+
+// The DP32 has no set/reset registers, so these are a read-modify-write
+// of DATA. With constant arguments the address and mask fold into literals.
+
+static inline __attribute__((always_inline)) void GPIO_PortSetPin(uint32_t Port, uint32_t Num)
+{
+    GPIO_PORT_BANK(Port)->DATA |= 1U << Num;
+}
+
+static inline __attribute__((always_inline)) void GPIO_PortResetPin(uint32_t Port, uint32_t Num)
+{
+    GPIO_PORT_BANK(Port)->DATA &= ~(1U << Num);
+}
+
+static inline __attribute__((always_inline)) uint32_t GPIO_PortGetPin(uint32_t Port, uint32_t Num)
+{
+    return (GPIO_PORT_BANK(Port)->DATA >> Num) & 1U;
+}
+
+static inline __attribute__((always_inline)) void GPIO_PortSetPinDir(uint32_t Port, uint32_t Num, uint32_t Dir)
+{
+    if (0U == Dir) // GPIO_DIR_INPUT
+    {
+        *GPIO_PORT_IE(Port) |= 1U << Num;
+        GPIO_PORT_BANK(Port)->DIR &= ~(1U << Num);
+    }
+    else
+    {
+        *GPIO_PORT_IE(Port) &= ~(1U << Num);
+        GPIO_PORT_BANK(Port)->DIR |= 1U << Num;
+    }
+}
+
+#endif
@@ -22,29 +22,30 @@
 #define _PIN_MAPPING(Bank, PinNum) (((0xffff & (uint32_t)(Bank)) << 16) | (0xffff & (PinNum)))
 #define _GPIO_BANK(Pin) ((volatile GPIO_Bank_t *)(GPIOA_BASE_ADDR | (0xffff & ((Pin) >> 16))))
 #define _PIN_NUM(Pin) (0xffff & (Pin))
+#define _PIN_ENTRY(Pin) _PIN_MAPPING(GPIOA_BASE_ADDR + Pin##_PORT * GPIOA_BASE_SIZE, Pin##_NUM)
 
 static const uint32_t _PinMappings[] = {
-    _PIN_MAPPING(GPIOA_BASE_ADDR, 3),  // GPIO_PIN_KEYBOARD_0
-    _PIN_MAPPING(GPIOA_BASE_ADDR, 4),  // GPIO_PIN_KEYBOARD_1
-    _PIN_MAPPING(GPIOA_BASE_ADDR, 5),  // GPIO_PIN_KEYBOARD_2
-    _PIN_MAPPING(GPIOA_BASE_ADDR, 6),  // GPIO_PIN_KEYBOARD_3
-    _PIN_MAPPING(GPIOA_BASE_ADDR, 10), // GPIO_PIN_KEYBOARD_4
-    _PIN_MAPPING(GPIOA_BASE_ADDR, 11), // GPIO_PIN_KEYBOARD_5
-    _PIN_MAPPING(GPIOA_BASE_ADDR, 12), // GPIO_PIN_KEYBOARD_6
-    _PIN_MAPPING(GPIOA_BASE_ADDR, 13), // GPIO_PIN_KEYBOARD_7
-    _PIN_MAPPING(GPIOB_BASE_ADDR, 6),  // GPIO_PIN_BACKLIGHT
-    _PIN_MAPPING(GPIOB_BASE_ADDR, 9),  // GPIO_PIN_ST7565_A0
-    _PIN_MAPPING(GPIOB_BASE_ADDR, 11), // GPIO_PIN_ST7565_RES
-    0,                                 // GPIO_PIN_ST7565_CS, !! Not used
-    0,                                 // GPIO_PIN_ST7565_SCLK, !! Not used
-    0,                                 // GPIO_PIN_ST7565_SDA, !! Not used
-    _PIN_MAPPING(GPIOB_BASE_ADDR, 15), // GPIO_PIN_BK1080
-    _PIN_MAPPING(GPIOC_BASE_ADDR, 0),  // GPIO_PIN_BK4819_SCN
-    _PIN_MAPPING(GPIOC_BASE_ADDR, 1),  // GPIO_PIN_BK4819_SCL
-    _PIN_MAPPING(GPIOC_BASE_ADDR, 2),  // GPIO_PIN_BK4819_SDA
-    _PIN_MAPPING(GPIOC_BASE_ADDR, 3),  // GPIO_PIN_FLASHLIGHT
-    _PIN_MAPPING(GPIOC_BASE_ADDR, 4),  // GPIO_PIN_AUDIO_PATH
-    _PIN_MAPPING(GPIOC_BASE_ADDR, 5),  // GPIO_PIN_PTT
+    _PIN_ENTRY(GPIO_PIN_KEYBOARD_0),
+    _PIN_ENTRY(GPIO_PIN_KEYBOARD_1),
+    _PIN_ENTRY(GPIO_PIN_KEYBOARD_2),
+    _PIN_ENTRY(GPIO_PIN_KEYBOARD_3),
+    _PIN_ENTRY(GPIO_PIN_KEYBOARD_4),
+    _PIN_ENTRY(GPIO_PIN_KEYBOARD_5),
+    _PIN_ENTRY(GPIO_PIN_KEYBOARD_6),
+    _PIN_ENTRY(GPIO_PIN_KEYBOARD_7),
+    _PIN_ENTRY(GPIO_PIN_BACKLIGHT),
+    _PIN_ENTRY(GPIO_PIN_ST7565_A0),
+    _PIN_ENTRY(GPIO_PIN_ST7565_RES),
+    0, // GPIO_PIN_ST7565_CS, !! Not used
+    0, // GPIO_PIN_ST7565_SCLK, !! Not used
+    0, // GPIO_PIN_ST7565_SDA, !! Not used
+    _PIN_ENTRY(GPIO_PIN_BK1080),
+    _PIN_ENTRY(GPIO_PIN_BK4819_SCN),
+    _PIN_ENTRY(GPIO_PIN_BK4819_SCL),
+    _PIN_ENTRY(GPIO_PIN_BK4819_SDA),
+    _PIN_ENTRY(GPIO_PIN_FLASHLIGHT),
+    _PIN_ENTRY(GPIO_PIN_AUDIO_PATH),
+    _PIN_ENTRY(GPIO_PIN_PTT),
 };
 
 static inline void GPIO_ClearBit(volatile uint32_t *pReg, uint8_t Bit)
@@ -0,0 +1,60 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#include "driver/gpio.h"
+#include "driver/system.h"
+#include "driver/systick.h"
+#include "driver/voice.h"
+
+// No timer driver on this board yet: the ID is bit-banged in place.
+
+void VOICE_Init(void)
+{
+}
+
+void VOICE_Send(uint8_t VoiceID)
+{
+	uint8_t i;
+
+	// GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_VOICE_0);
+	GPIO_SetOutputPin(GPIO_PIN_VOICE_0);
+	SYSTEM_DelayMs(20);
+	// GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_VOICE_0);
+	GPIO_ResetOutputPin(GPIO_PIN_VOICE_0);
+	for (i = 0; i < 8; i++) {
+		if ((VoiceID & 0x80U) == 0) {
+			// GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_VOICE_1);
+			GPIO_ResetOutputPin(GPIO_PIN_VOICE_1);
+		} else {
+			// GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_VOICE_1);
+			GPIO_SetOutputPin(GPIO_PIN_VOICE_1);
+		}
+		SYSTICK_DelayUs(1000);
+		// GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_VOICE_0);
+		GPIO_SetOutputPin(GPIO_PIN_VOICE_0);
+		SYSTICK_DelayUs(1200);
+		// GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_VOICE_0);
+		GPIO_ResetOutputPin(GPIO_PIN_VOICE_0);
+		VoiceID <<= 1;
+		SYSTICK_DelayUs(200);
+	}
+}
+
+bool VOICE_IsBusy(void)
+{
+	return false;
+}
+
@@ -18,8 +18,10 @@
 #include "driver/st7565.h"
 #include "driver/bk1080.h"
 #include "driver/crc.h"
+#include "driver/keyboard.h"
 #include "driver/system.h"
 #include "driver/systick.h"
+#include "driver/voice.h"
 
 #include "py32f0xx_ll_bus.h"
 #include "py32f0xx_ll_rcc.h"
@@ -28,30 +30,52 @@
 #include "py32f0xx_ll_utils.h"
 #include "py32f0xx_ll_system.h"
 #include "py32f0xx_ll_adc.h"
+#include "py32f0xx_ll_dma.h"
+#include "py32f0xx_ll_tim.h"
+#include "py32f0xx_ll_exti.h"
 
 static void APP_SystemClockConfig(void);
 static void BOARD_GPIO_Init(void);
 static void BOARD_ADC_Init(void);
+#if defined(ENABLE_KEYPAD_WAKE)
+static void BOARD_KEYBOARD_InitWake(void);
+#endif
+
+// Battery voltage (CH4) and current (CH9) are sampled in the background:
+// TIM3 TRGO starts a CH4, CH9 scan sequence every _ADC_TRIGGER_MS, and DMA1
+// channel 1 stores the results into a circular buffer of _ADC_PAIRS pairs.
+// Reading them never blocks.
+
+#define _ADC_DMA_CHANNEL LL_DMA_CHANNEL_1
+#define _ADC_PAIRS 16U // Power of 2
+#define _ADC_BUFFER_LEN (_ADC_PAIRS * 2U)
+#define _ADC_TRIGGER_MS 20U
+
+static volatile uint16_t _AdcBuffer[_ADC_BUFFER_LEN];
 
 void BOARD_ADC_GetBatteryInfo(uint16_t *pVoltage, uint16_t *pCurrent)
 {
-    static const uint32_t CHANNELS[2] = {LL_ADC_CHANNEL_4, LL_ADC_CHANNEL_9};
+    // Most recent complete pair: the one before the pair DMA is filling
+    const uint32_t Written = _ADC_BUFFER_LEN - LL_DMA_GetDataLength(DMA1, _ADC_DMA_CHANNEL);
+    const uint32_t Pair = (Written / 2U + _ADC_PAIRS - 1U) % _ADC_PAIRS;
+
+    *pVoltage = _AdcBuffer[Pair * 2U + 0U];
+    *pCurrent = _AdcBuffer[Pair * 2U + 1U];
+}
+
+void BOARD_ADC_GetBatteryAverage(uint16_t *pVoltage, uint16_t *pCurrent)
+{
+    uint32_t Voltage = 0;
+    uint32_t Current = 0;
 
-    uint16_t Data[2];
-    for (int i = 0; i < 2; i++)
+    for (uint32_t i = 0; i < _ADC_PAIRS; i++)
     {
-        LL_ADC_REG_SetSequencerChannels(ADC1, CHANNELS[i]);
-        LL_ADC_Enable(ADC1);
-        SYSTEM_DelayMs(1);
-        LL_ADC_REG_StartConversion(ADC1);
-        while (!LL_ADC_IsActiveFlag_EOC(ADC1))
-            ;
-        LL_ADC_ClearFlag_EOC(ADC1);
-        Data[i] = LL_ADC_REG_ReadConversionData12(ADC1);
+        Voltage += _AdcBuffer[i * 2U + 0U];
+        Current += _AdcBuffer[i * 2U + 1U];
     }
 
-    *pVoltage = Data[0];
-    *pCurrent = Data[1];
+    *pVoltage = Voltage / _ADC_PAIRS;
+    *pCurrent = Current / _ADC_PAIRS;
 }
 
 void BOARD_Init(void)
@@ -67,8 +91,12 @@ void BOARD_Init(void)
     SYSTICK_Init();
 
     BOARD_GPIO_Init();
+#if defined(ENABLE_KEYPAD_WAKE)
+    BOARD_KEYBOARD_InitWake();
+#endif
     BOARD_ADC_Init();
     ST7565_Init();
+    VOICE_Init();
 #if defined(ENABLE_FMRADIO)
     BK1080_Init(0, false);
 #endif
@@ -178,6 +206,35 @@ static void BOARD_GPIO_Init(void)
 #endif
 }
 
+#if defined(ENABLE_KEYPAD_WAKE)
+
+// Keypad wake: falling edge on a column input while the rows are parked low
+// (KEYBOARD_IsAnyKeyDown).
+//
+// EXTI lines are shared between ports, so PF0 / PA0 (line 0) and PF1 / PA1
+// (line 1) can't both be watched. The F port columns carry the side keys and
+// half of the matrix; keys on PA0 / PA1 are still caught by the parked level
+// check in the 10 ms slice.
+static void BOARD_KEYBOARD_InitWake(void)
+{
+    LL_EXTI_SetEXTISource(LL_EXTI_CONFIG_PORTF, LL_EXTI_CONFIG_LINE0);
+    LL_EXTI_SetEXTISource(LL_EXTI_CONFIG_PORTF, LL_EXTI_CONFIG_LINE1);
+    LL_EXTI_EnableFallingTrig(LL_EXTI_LINE_0 | LL_EXTI_LINE_1);
+    LL_EXTI_ClearFlag(LL_EXTI_LINE_0 | LL_EXTI_LINE_1);
+    LL_EXTI_EnableIT(LL_EXTI_LINE_0 | LL_EXTI_LINE_1);
+
+    NVIC_SetPriority(EXTI0_1_IRQn, 3);
+    NVIC_EnableIRQ(EXTI0_1_IRQn);
+}
+
+void EXTI0_1_IRQHandler(void)
+{
+    LL_EXTI_ClearFlag(LL_EXTI_LINE_0 | LL_EXTI_LINE_1);
+    gKeyboardWakePending = true;
+}
+
+#endif
+
 static void BOARD_ADC_Init(void)
 {
 
@@ -207,4 +264,55 @@ static void BOARD_ADC_Init(void)
     LL_ADC_REG_SetOverrun(ADC1, LL_ADC_REG_OVR_DATA_OVERWRITTEN);
     LL_ADC_REG_SetSequencerDiscont(ADC1, LL_ADC_REG_SEQ_DISCONT_DISABLE);
     LL_ADC_REG_SetContinuousMode(ADC1, LL_ADC_REG_CONV_SINGLE);
+    LL_ADC_REG_SetSequencerScanDirection(ADC1, LL_ADC_REG_SEQ_SCAN_DIR_FORWARD);
+    LL_ADC_REG_SetSequencerChannels(ADC1, LL_ADC_CHANNEL_4 | LL_ADC_CHANNEL_9);
+    LL_ADC_REG_SetDMATransfer(ADC1, LL_ADC_REG_DMA_TRANSFER_UNLIMITED);
+
+    // DMA
+    do
+    {
+        LL_AHB1_GRP1_EnableClock(LL_AHB1_GRP1_PERIPH_DMA1);
+        LL_DMA_DisableChannel(DMA1, _ADC_DMA_CHANNEL);
+
+        LL_DMA_InitTypeDef DMA_InitStruct;
+        LL_DMA_StructInit(&DMA_InitStruct);
+
+        DMA_InitStruct.Direction = LL_DMA_DIRECTION_PERIPH_TO_MEMORY;
+        DMA_InitStruct.Mode = LL_DMA_MODE_CIRCULAR;
+        DMA_InitStruct.PeriphOrM2MSrcAddress = LL_ADC_DMA_GetRegAddr(ADC1, LL_ADC_DMA_REG_REGULAR_DATA);
+        DMA_InitStruct.PeriphOrM2MSrcIncMode = LL_DMA_PERIPH_NOINCREMENT;
+        DMA_InitStruct.PeriphOrM2MSrcDataSize = LL_DMA_PDATAALIGN_HALFWORD;
+        DMA_InitStruct.MemoryOrM2MDstAddress = (uint32_t)_AdcBuffer;
+        DMA_InitStruct.MemoryOrM2MDstDataSize = LL_DMA_MDATAALIGN_HALFWORD;
+        DMA_InitStruct.MemoryOrM2MDstIncMode = LL_DMA_MEMORY_INCREMENT;
+        DMA_InitStruct.NbData = _ADC_BUFFER_LEN;
+        DMA_InitStruct.Priority = LL_DMA_PRIORITY_LOW;
+
+        LL_DMA_Init(DMA1, _ADC_DMA_CHANNEL, &DMA_InitStruct);
+
+        LL_SYSCFG_SetDMARemap_CH1(LL_SYSCFG_DMA_MAP_ADC);
+        LL_DMA_EnableChannel(DMA1, _ADC_DMA_CHANNEL);
+    } while (0);
+
+    LL_ADC_Enable(ADC1);
+    SYSTEM_DelayMs(1);
+
+    // Fill the whole buffer once by software so averages are valid right
+    // after boot; DMA wraps back to the first pair afterwards
+    for (uint32_t i = 0; i < _ADC_PAIRS; i++)
+    {
+        LL_ADC_REG_StartConversion(ADC1);
+        while (LL_ADC_REG_IsConversionOngoing(ADC1))
+            ;
+    }
+
+    // Hand over to TIM3
+    LL_ADC_REG_SetTriggerSource(ADC1, LL_ADC_REG_TRIG_EXT_TIM3_TRGO);
+    LL_ADC_REG_StartConversion(ADC1);
+
+    LL_APB1_GRP1_EnableClock(LL_APB1_GRP1_PERIPH_TIM3);
+    LL_TIM_SetPrescaler(TIM3, __LL_TIM_CALC_PSC(SystemCoreClock, 1000));
+    LL_TIM_SetAutoReload(TIM3, _ADC_TRIGGER_MS - 1U);
+    LL_TIM_SetTriggerOutput(TIM3, LL_TIM_TRGO_UPDATE);
+    LL_TIM_EnableCounter(TIM3);
 }
@@ -0,0 +1,98 @@
+/* Copyright 2025 muzkr https://github.com/muzkr
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#ifndef DRIVER_V2_GPIO_PINS_H
+#define DRIVER_V2_GPIO_PINS_H
+
+#include <stdint.h>
+#include "py32f0xx.h"
+
+// Board pin assignment: port and pin number.
+// _PinMapping[] in v2/gpio.c is built from the same definitions.
+
+#define GPIO_PIN_KEYBOARD_0_PORT GPIOF
+#define GPIO_PIN_KEYBOARD_0_NUM 0
+#define GPIO_PIN_KEYBOARD_1_PORT GPIOF
+#define GPIO_PIN_KEYBOARD_1_NUM 1
+#define GPIO_PIN_KEYBOARD_2_PORT GPIOA
+#define GPIO_PIN_KEYBOARD_2_NUM 0
+#define GPIO_PIN_KEYBOARD_3_PORT GPIOA
+#define GPIO_PIN_KEYBOARD_3_NUM 1
+#define GPIO_PIN_KEYBOARD_4_PORT GPIOA
+#define GPIO_PIN_KEYBOARD_4_NUM 5
+#define GPIO_PIN_KEYBOARD_5_PORT GPIOA
+#define GPIO_PIN_KEYBOARD_5_NUM 6
+#define GPIO_PIN_KEYBOARD_6_PORT GPIOA
+#define GPIO_PIN_KEYBOARD_6_NUM 7
+#define GPIO_PIN_KEYBOARD_7_PORT GPIOB
+#define GPIO_PIN_KEYBOARD_7_NUM 0
+#define GPIO_PIN_BACKLIGHT_PORT GPIOA
+#define GPIO_PIN_BACKLIGHT_NUM 8
+#define GPIO_PIN_ST7565_A0_PORT GPIOA
+#define GPIO_PIN_ST7565_A0_NUM 11
+#define GPIO_PIN_ST7565_RES_PORT GPIOA
+#define GPIO_PIN_ST7565_RES_NUM 13
+#define GPIO_PIN_ST7565_CS_PORT GPIOA
+#define GPIO_PIN_ST7565_CS_NUM 9
+#define GPIO_PIN_ST7565_SCLK_PORT GPIOA
+#define GPIO_PIN_ST7565_SCLK_NUM 10
+#define GPIO_PIN_ST7565_SDA_PORT GPIOA
+#define GPIO_PIN_ST7565_SDA_NUM 12
+#define GPIO_PIN_BK1080_PORT GPIOA // !! Same as GPIO_PIN_ST7565_RES
+#define GPIO_PIN_BK1080_NUM 13
+#define GPIO_PIN_BK4819_SCN_PORT GPIOB
+#define GPIO_PIN_BK4819_SCN_NUM 3
+#define GPIO_PIN_BK4819_SCL_PORT GPIOB
+#define GPIO_PIN_BK4819_SCL_NUM 4
+#define GPIO_PIN_BK4819_SDA_PORT GPIOB
+#define GPIO_PIN_BK4819_SDA_NUM 5
+#define GPIO_PIN_FLASHLIGHT_PORT GPIOB
+#define GPIO_PIN_FLASHLIGHT_NUM 6
+#define GPIO_PIN_AUDIO_PATH_PORT GPIOB
+#define GPIO_PIN_AUDIO_PATH_NUM 7
+#define GPIO_PIN_PTT_PORT GPIOA // !! Also used as UART RX
+#define GPIO_PIN_PTT_NUM 3
+
+#define GPIO_PIN_I2C_SCL_PORT GPIO_PIN_KEYBOARD_4_PORT
+#define GPIO_PIN_I2C_SCL_NUM GPIO_PIN_KEYBOARD_4_NUM
+#define GPIO_PIN_I2C_SDA_PORT GPIO_PIN_KEYBOARD_5_PORT
+#define GPIO_PIN_I2C_SDA_NUM GPIO_PIN_KEYBOARD_5_NUM
+#define GPIO_PIN_VOICE_0_PORT GPIO_PIN_KEYBOARD_6_PORT
+#define GPIO_PIN_VOICE_0_NUM GPIO_PIN_KEYBOARD_6_NUM
+#define GPIO_PIN_VOICE_1_PORT GPIO_PIN_KEYBOARD_7_PORT
+#define GPIO_PIN_VOICE_1_NUM GPIO_PIN_KEYBOARD_7_NUM
+
+static inline __attribute__((always_inline)) void GPIO_PortSetPin(GPIO_TypeDef *Port, uint32_t Num)
+{
+    Port->BSRR = 1U << Num;
+}
+
+static inline __attribute__((always_inline)) void GPIO_PortResetPin(GPIO_TypeDef *Port, uint32_t Num)
+{
+    Port->BRR = 1U << Num;
+}
+
+static inline __attribute__((always_inline)) uint32_t GPIO_PortGetPin(GPIO_TypeDef *Port, uint32_t Num)
+{
+    return (Port->IDR >> Num) & 1U;
+}
+
+static inline __attribute__((always_inline)) void GPIO_PortSetPinDir(GPIO_TypeDef *Port, uint32_t Num, uint32_t Dir)
+{
+    // MODER: 00 = input, 01 = output
+    Port->MODER = (Port->MODER & ~(3U << (Num * 2U))) | ((0U == Dir ? 0U : 1U) << (Num * 2U));
+}
+
+#endif
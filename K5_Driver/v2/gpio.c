@@ -21,29 +21,30 @@
 #define _PIN_MAPPING(Port, Pin) ((0xffff & ((uint32_t)(Port))) << 16 | (0xffff & (Pin)))
 #define _PIN_PORT(Pin) ((GPIO_TypeDef *)(IOPORT_BASE + ((Pin) >> 16)))
 #define _PIN_PIN(Pin) (0xffff & (Pin))
+#define _PIN_ENTRY(Pin) _PIN_MAPPING(Pin##_PORT, 1U << Pin##_NUM)
 
 static const uint32_t _PinMapping[] = {
-    _PIN_MAPPING(GPIOF, LL_GPIO_PIN_0),  //    GPIO_PIN_KEYBOARD_0
-    _PIN_MAPPING(GPIOF, LL_GPIO_PIN_1),  //     GPIO_PIN_KEYBOARD_1
-    _PIN_MAPPING(GPIOA, LL_GPIO_PIN_0),  //     GPIO_PIN_KEYBOARD_2
-    _PIN_MAPPING(GPIOA, LL_GPIO_PIN_1),  //     GPIO_PIN_KEYBOARD_3
-    _PIN_MAPPING(GPIOA, LL_GPIO_PIN_5),  //     GPIO_PIN_KEYBOARD_4
-    _PIN_MAPPING(GPIOA, LL_GPIO_PIN_6),  //     GPIO_PIN_KEYBOARD_5
-    _PIN_MAPPING(GPIOA, LL_GPIO_PIN_7),  //     GPIO_PIN_KEYBOARD_6
-    _PIN_MAPPING(GPIOB, LL_GPIO_PIN_0),  //     GPIO_PIN_KEYBOARD_7
-    _PIN_MAPPING(GPIOA, LL_GPIO_PIN_8),  //     GPIO_PIN_BACKLIGHT
-    _PIN_MAPPING(GPIOA, LL_GPIO_PIN_11), //     GPIO_PIN_ST7565_A0
-    _PIN_MAPPING(GPIOA, LL_GPIO_PIN_13), //     GPIO_PIN_ST7565_RES
-    _PIN_MAPPING(GPIOA, LL_GPIO_PIN_9),  //     GPIO_PIN_ST7565_CS
-    _PIN_MAPPING(GPIOA, LL_GPIO_PIN_10), //     GPIO_PIN_ST7565_SCLK
-    _PIN_MAPPING(GPIOA, LL_GPIO_PIN_12), //     GPIO_PIN_ST7565_SDA
-    _PIN_MAPPING(GPIOA, LL_GPIO_PIN_13), //     GPIO_PIN_BK1080, !! Same as GPIO_PIN_ST7565_RES
-    _PIN_MAPPING(GPIOB, LL_GPIO_PIN_3),  //     GPIO_PIN_BK4819_SCN,
-    _PIN_MAPPING(GPIOB, LL_GPIO_PIN_4),  //     GPIO_PIN_BK4819_SCL,
-    _PIN_MAPPING(GPIOB, LL_GPIO_PIN_5),  //     GPIO_PIN_BK4819_SDA,
-    _PIN_MAPPING(GPIOB, LL_GPIO_PIN_6),  //     GPIO_PIN_FLASHLIGHT,
-    _PIN_MAPPING(GPIOB, LL_GPIO_PIN_7),  //     GPIO_PIN_AUDIO_PATH,
-    _PIN_MAPPING(GPIOA, LL_GPIO_PIN_3),  //     GPIO_PIN_PTT, !! Also used as UART RX
+    _PIN_ENTRY(GPIO_PIN_KEYBOARD_0),
+    _PIN_ENTRY(GPIO_PIN_KEYBOARD_1),
+    _PIN_ENTRY(GPIO_PIN_KEYBOARD_2),
+    _PIN_ENTRY(GPIO_PIN_KEYBOARD_3),
+    _PIN_ENTRY(GPIO_PIN_KEYBOARD_4),
+    _PIN_ENTRY(GPIO_PIN_KEYBOARD_5),
+    _PIN_ENTRY(GPIO_PIN_KEYBOARD_6),
+    _PIN_ENTRY(GPIO_PIN_KEYBOARD_7),
+    _PIN_ENTRY(GPIO_PIN_BACKLIGHT),
+    _PIN_ENTRY(GPIO_PIN_ST7565_A0),
+    _PIN_ENTRY(GPIO_PIN_ST7565_RES),
+    _PIN_ENTRY(GPIO_PIN_ST7565_CS),
+    _PIN_ENTRY(GPIO_PIN_ST7565_SCLK),
+    _PIN_ENTRY(GPIO_PIN_ST7565_SDA),
+    _PIN_ENTRY(GPIO_PIN_BK1080),
+    _PIN_ENTRY(GPIO_PIN_BK4819_SCN),
+    _PIN_ENTRY(GPIO_PIN_BK4819_SCL),
+    _PIN_ENTRY(GPIO_PIN_BK4819_SDA),
+    _PIN_ENTRY(GPIO_PIN_FLASHLIGHT),
+    _PIN_ENTRY(GPIO_PIN_AUDIO_PATH),
+    _PIN_ENTRY(GPIO_PIN_PTT),
 };
 
 void GPIO_SetPinDir(uint32_t Pin, uint32_t Dir)
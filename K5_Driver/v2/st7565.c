@@ -19,6 +19,7 @@
 #include <string.h>
 #include "py32f0xx_ll_gpio.h"
 #include "driver/gpio.h"
+#include "driver/ramfunc.h"
 #include "driver/st7565.h"
 #include "driver/system.h"
 #include "misc.h"
@@ -175,7 +176,7 @@ void ST7565_SelectColumnAndLine(uint8_t Column, uint8_t Line)
     ST7565_WriteByte((Column >> 0) & 0x0F);
 }
 
-void ST7565_WriteByte(uint8_t Value)
+RAMFUNC_ST7565_WRITE void ST7565_WriteByte(uint8_t Value)
 {
     LL_GPIO_ResetOutputPin(_PORT_LCD, _PIN_SCLK);
 
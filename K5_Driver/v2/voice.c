@@ -0,0 +1,127 @@
+/* Copyright 2025 muzkr
+ * https://github.com/muzkr
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#include "driver/voice.h"
+#include "driver/gpio.h"
+
+#include "py32f0xx_ll_bus.h"
+#include "py32f0xx_ll_tim.h"
+
+// The ID is clocked out from the TIM16 update interrupt. The timer counts
+// microseconds in one-pulse mode: each update applies the pin levels of
+// `_Phase` and restarts the timer with that phase's length.
+
+#define _VOICE_START_US 20000U
+#define _VOICE_SETUP_US 1000U
+#define _VOICE_CLOCK_US 1200U
+#define _VOICE_HOLD_US 200U
+
+enum
+{
+    _PHASE_SETUP = 0,
+    _PHASE_CLOCK,
+    _PHASE_HOLD,
+};
+
+static volatile bool _Busy;
+static uint8_t _VoiceID;
+static uint8_t _Bit;
+static uint8_t _Phase;
+
+static inline void _StartPhase(uint16_t Us)
+{
+    LL_TIM_SetAutoReload(TIM16, Us - 1U);
+    LL_TIM_SetCounter(TIM16, 0);
+    LL_TIM_EnableCounter(TIM16);
+}
+
+void VOICE_Init(void)
+{
+    LL_APB1_GRP2_EnableClock(LL_APB1_GRP2_PERIPH_TIM16);
+
+    LL_TIM_SetPrescaler(TIM16, __LL_TIM_CALC_PSC(SystemCoreClock, 1000000));
+    LL_TIM_SetOnePulseMode(TIM16, LL_TIM_ONEPULSEMODE_SINGLE);
+    LL_TIM_SetUpdateSource(TIM16, LL_TIM_UPDATESOURCE_COUNTER);
+    // Load the prescaler
+    LL_TIM_GenerateEvent_UPDATE(TIM16);
+    LL_TIM_ClearFlag_UPDATE(TIM16);
+    LL_TIM_EnableIT_UPDATE(TIM16);
+
+    NVIC_SetPriority(TIM16_IRQn, 1);
+    NVIC_EnableIRQ(TIM16_IRQn);
+}
+
+void VOICE_Send(uint8_t VoiceID)
+{
+    while (_Busy)
+    {
+    }
+
+    _VoiceID = VoiceID;
+    _Bit = 0;
+    _Phase = _PHASE_SETUP;
+    _Busy = true;
+
+    GPIO_FAST_SET(GPIO_PIN_VOICE_0);
+    _StartPhase(_VOICE_START_US);
+}
+
+bool VOICE_IsBusy(void)
+{
+    return _Busy;
+}
+
+void TIM16_IRQHandler(void)
+{
+    LL_TIM_ClearFlag_UPDATE(TIM16);
+
+    switch (_Phase)
+    {
+    case _PHASE_SETUP:
+        GPIO_FAST_RESET(GPIO_PIN_VOICE_0);
+        if (_Bit == 8)
+        {
+            _Busy = false;
+            break;
+        }
+        if (_VoiceID & 0x80U)
+        {
+            GPIO_FAST_SET(GPIO_PIN_VOICE_1);
+        }
+        else
+        {
+            GPIO_FAST_RESET(GPIO_PIN_VOICE_1);
+        }
+        _Phase = _PHASE_CLOCK;
+        _StartPhase(_VOICE_SETUP_US);
+        break;
+
+    case _PHASE_CLOCK:
+        GPIO_FAST_SET(GPIO_PIN_VOICE_0);
+        _Phase = _PHASE_HOLD;
+        _StartPhase(_VOICE_CLOCK_US);
+        break;
+
+    case _PHASE_HOLD:
+        GPIO_FAST_RESET(GPIO_PIN_VOICE_0);
+        _VoiceID <<= 1;
+        _Bit++;
+        _Phase = _PHASE_SETUP;
+        _StartPhase(_VOICE_HOLD_US);
+        break;
+    }
+}
+
@@ -30,6 +30,7 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+#include <limits.h>
 #include <stdbool.h>
 #include <stdint.h>
 
@@ -95,6 +96,22 @@
 #define PRINTF_SUPPORT_PTRDIFF_T
 #endif
 
+// fast paths for buffer output and integers: runs of text are written
+// straight into the buffer instead of through the output function one
+// character at a time, and integer digits come from shifts (base 2, 8, 16)
+// or a reciprocal multiply (base 10) instead of a division per digit
+// default: activated
+#ifndef PRINTF_DISABLE_FAST_PATH
+#define PRINTF_SUPPORT_FAST_PATH
+#endif
+
+// printf()/vprintf() collect this many characters before handing them to
+// _putbuffer(), instead of calling _putchar() for every single character
+// default: 0 (one _putchar() call per character)
+#ifndef PRINTF_OUTPUT_BUFFER_SIZE
+#define PRINTF_OUTPUT_BUFFER_SIZE  0U
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 
 // internal flag definitions
@@ -129,6 +146,15 @@ typedef struct {
 } out_fct_wrap_type;
 
 
+#if (PRINTF_OUTPUT_BUFFER_SIZE > 0U)
+// chunk (used as buffer) for the buffered _putbuffer() output
+typedef struct {
+  char   data[PRINTF_OUTPUT_BUFFER_SIZE];
+  size_t len;
+} out_chunk_type;
+#endif
+
+
 // internal buffer output
 static inline void _out_buffer(char character, void* buffer, size_t idx, size_t maxlen)
 {
@@ -166,6 +192,43 @@ static inline void _out_fct(char character, void* buffer, size_t idx, size_t max
 }
 
 
+#if (PRINTF_OUTPUT_BUFFER_SIZE > 0U)
+// internal _putbuffer wrapper, hands over whole chunks
+static void _out_chunk(char character, void* buffer, size_t idx, size_t maxlen)
+{
+  out_chunk_type* chunk = (out_chunk_type*)buffer;
+  (void)idx; (void)maxlen;
+  if (character) {
+    chunk->data[chunk->len++] = character;
+  }
+  // the terminating \0 flushes what is left
+  if ((chunk->len == PRINTF_OUTPUT_BUFFER_SIZE) || (!character && chunk->len)) {
+    _putbuffer(chunk->data, chunk->len);
+    chunk->len = 0U;
+  }
+}
+#endif
+
+
+// output len characters from str
+static inline size_t _out_run(out_fct_type out, char* buffer, size_t idx, size_t maxlen, const char* str, size_t len)
+{
+#if defined(PRINTF_SUPPORT_FAST_PATH)
+  if (out == _out_buffer) {
+    // direct call, inlined: no indirect call per character
+    while (len--) {
+      _out_buffer(*(str++), buffer, idx++, maxlen);
+    }
+    return idx;
+  }
+#endif
+  while (len--) {
+    out(*(str++), buffer, idx++, maxlen);
+  }
+  return idx;
+}
+
+
 // internal secure strlen
 // \return The length of the string (excluding the terminating 0) limited by 'maxsize'
 static inline unsigned int _strnlen_s(const char* str, size_t maxsize)
@@ -208,6 +271,14 @@ static size_t _out_rev(out_fct_type out, char* buffer, size_t idx, size_t maxlen
   }
 
   // reverse string
+#if defined(PRINTF_SUPPORT_FAST_PATH)
+  if (out == _out_buffer) {
+    // direct call, inlined; leaves nothing for the loop below
+    while (len) {
+      _out_buffer(buf[--len], buffer, idx++, maxlen);
+    }
+  }
+#endif
   while (len) {
     out(buf[--len], buffer, idx++, maxlen);
   }
@@ -277,6 +348,49 @@ static size_t _ntoa_format(out_fct_type out, char* buffer, size_t idx, size_t ma
 }
 
 
+#if defined(PRINTF_SUPPORT_FAST_PATH)
+// internal digits of a 'long' value in reverse, without a division per digit
+// \return The number of digits
+static size_t _ntoa_digits(char* buf, unsigned long value, unsigned int base, unsigned int flags)
+{
+  size_t len = 0U;
+
+#if (ULONG_MAX > 0xFFFFFFFFUL)
+  if ((base == 10U) && (value <= 0xFFFFFFFFUL)) {
+#else
+  if (base == 10U) {
+#endif
+    // value / 10 as (value * ceil(2^35 / 10)) >> 35, exact for all 32 bits
+    uint32_t v = (uint32_t)value;
+    do {
+      const uint32_t q = (uint32_t)(((uint64_t)v * 0xCCCCCCCDU) >> 35U);
+      buf[len++] = (char)('0' + (v - q * 10U));
+      v = q;
+    } while (v && (len < PRINTF_NTOA_BUFFER_SIZE));
+  }
+  else if ((base & (base - 1U)) == 0U) {
+    // 2, 8 and 16 are masks and shifts
+    const char letter = (flags & FLAGS_UPPERCASE) ? 'A' : 'a';
+    const unsigned int shift = (base == 16U) ? 4U : (base == 8U) ? 3U : 1U;
+    do {
+      const char digit = (char)(value & (base - 1U));
+      buf[len++] = digit < 10 ? '0' + digit : letter + digit - 10;
+      value >>= shift;
+    } while (value && (len < PRINTF_NTOA_BUFFER_SIZE));
+  }
+  else {
+    // base 10 beyond 32 bits, only where long is wider
+    do {
+      buf[len++] = (char)('0' + (value % base));
+      value /= base;
+    } while (value && (len < PRINTF_NTOA_BUFFER_SIZE));
+  }
+
+  return len;
+}
+#endif  // PRINTF_SUPPORT_FAST_PATH
+
+
 // internal itoa for 'long' type
 static size_t _ntoa_long(out_fct_type out, char* buffer, size_t idx, size_t maxlen, unsigned long value, bool negative, unsigned long base, unsigned int prec, unsigned int width, unsigned int flags)
 {
@@ -290,11 +404,15 @@ static size_t _ntoa_long(out_fct_type out, char* buffer, size_t idx, size_t maxl
 
   // write if precision != 0 and value is != 0
   if (!(flags & FLAGS_PRECISION) || value) {
+#if defined(PRINTF_SUPPORT_FAST_PATH)
+    len = _ntoa_digits(buf, value, (unsigned int)base, flags);
+#else
     do {
       const char digit = (char)(value % base);
       buf[len++] = digit < 10 ? '0' + digit : (flags & FLAGS_UPPERCASE ? 'A' : 'a') + digit - 10;
       value /= base;
     } while (value && (len < PRINTF_NTOA_BUFFER_SIZE));
+#endif
   }
 
   return _ntoa_format(out, buffer, idx, maxlen, buf, len, negative, (unsigned int)base, prec, width, flags);
@@ -589,8 +707,17 @@ static int _vsnprintf(out_fct_type out, char* buffer, const size_t maxlen, const
     // format specifier?  %[flags][width][.precision][length]
     if (*format != '%') {
       // no
+#if defined(PRINTF_SUPPORT_FAST_PATH)
+      // the whole run of text up to the next specifier in one go
+      const char* run = format;
+      while (*format && (*format != '%')) {
+        format++;
+      }
+      idx = _out_run(out, buffer, idx, maxlen, run, (size_t)(format - run));
+#else
       out(*format, buffer, idx++, maxlen);
       format++;
+#endif
       continue;
     }
     else {
@@ -800,15 +927,22 @@ static int _vsnprintf(out_fct_type out, char* buffer, const size_t maxlen, const
         if (flags & FLAGS_PRECISION) {
           l = (l < precision ? l : precision);
         }
+#if defined(PRINTF_SUPPORT_FAST_PATH)
+        const size_t len = l;
+#endif
         if (!(flags & FLAGS_LEFT)) {
           while (l++ < width) {
             out(' ', buffer, idx++, maxlen);
           }
         }
         // string output
+#if defined(PRINTF_SUPPORT_FAST_PATH)
+        idx = _out_run(out, buffer, idx, maxlen, p, len);
+#else
         while ((*p != 0) && (!(flags & FLAGS_PRECISION) || precision--)) {
           out(*(p++), buffer, idx++, maxlen);
         }
+#endif
         // post padding
         if (flags & FLAGS_LEFT) {
           while (l++ < width) {
@@ -863,8 +997,7 @@ int printf_(const char* format, ...)
 {
   va_list va;
   va_start(va, format);
-  char buffer[1];
-  const int ret = _vsnprintf(_out_char, buffer, (size_t)-1, format, va);
+  const int ret = vprintf_(format, va);
   va_end(va);
   return ret;
 }
@@ -892,8 +1025,14 @@ int snprintf_(char* buffer, size_t count, const char* format, ...)
 
 int vprintf_(const char* format, va_list va)
 {
+#if (PRINTF_OUTPUT_BUFFER_SIZE > 0U)
+  out_chunk_type chunk;
+  chunk.len = 0U;
+  return _vsnprintf(_out_chunk, (char*)(uintptr_t)&chunk, (size_t)-1, format, va);
+#else
   char buffer[1];
   return _vsnprintf(_out_char, buffer, (size_t)-1, format, va);
+#endif
 }
 
 
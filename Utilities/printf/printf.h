@@ -49,6 +49,16 @@ extern "C" {
 void _putchar(char character);
 
 
+/**
+ * Output a run of characters to a custom device, used by printf() instead of _putchar() when
+ * PRINTF_OUTPUT_BUFFER_SIZE is defined greater than 0. printf() then collects up to that many
+ * characters before each call, so a device like a UART gets whole runs instead of single bytes.
+ * \param buffer Characters to output, not terminated
+ * \param count Number of characters in buffer
+ */
+void _putbuffer(const char* buffer, size_t count);
+
+
 /**
  * Tiny printf implementation
  * You have to implement _putchar if you use printf()
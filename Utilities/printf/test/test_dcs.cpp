@@ -0,0 +1,136 @@
+/* Copyright 2025 muzkr https://github.com/muzkr
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+// Checks the Golay tables of App/dcs.c against the rotation scan they
+// replaced, on every 24 bit word. A program of its own, like test_format:
+//
+//   make APP=test_dcs FILES_PRJ=test/test_dcs C_INCLUDES=-I../../App
+//   bin/test_dcs
+
+// no POSIX signals, as in test_suite.cpp
+#define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_NO_POSIX_SIGNALS
+#include "catch.hpp"
+
+#include <stdint.h>
+
+extern "C" {
+  #include "dcs.h"
+  #include "dcs.c"
+}
+
+
+// The functions as they were before the tables, kept here as the reference
+namespace old {
+
+static uint32_t DCS_CalculateGolay(uint32_t CodeWord)
+{
+  uint32_t Word = CodeWord;
+
+  for (uint8_t i = 0; i < 12; i++) {
+    Word <<= 1;
+    if (Word & 0x1000) {
+      Word ^= 0x08EA;
+    }
+  }
+  return CodeWord | ((Word & 0x0FFE) << 11);
+}
+
+static uint32_t DCS_GetGolayCodeWord(DCS_CodeType_t CodeType, uint8_t Option)
+{
+  uint32_t Code = DCS_CalculateGolay(DCS_Options[Option] + 0x800U);
+
+  if (CodeType == CODE_TYPE_REVERSE_DIGITAL) {
+    Code ^= 0x7FFFFF;
+  }
+  return Code;
+}
+
+// With the codewords precomputed, which does not change the result but keeps
+// 2^24 calls to a few seconds
+static uint32_t CodeWords[ARRAY_SIZE(DCS_Options)];
+
+static uint8_t DCS_GetCdcssCode(uint32_t Code)
+{
+  for (uint8_t i = 0; i < 23; i++) {
+    if (((Code >> 9) & 0x7U) == 4) {
+      for (uint8_t j = 0; j < ARRAY_SIZE(DCS_Options); j++) {
+        if (DCS_Options[j] == (Code & 0x1FF) && CodeWords[j] == Code) {
+          return j;
+        }
+      }
+    }
+    Code = (Code >> 1) | ((Code & 1U) << 22);
+  }
+  return 0xFF;
+}
+
+} // namespace old
+
+
+TEST_CASE("DCS_GetGolayCodeWord", "[dcs]" ) {
+  for (uint8_t i = 0; i < ARRAY_SIZE(DCS_Options); i++) {
+    REQUIRE(DCS_GetGolayCodeWord(CODE_TYPE_DIGITAL, i) == old::DCS_GetGolayCodeWord(CODE_TYPE_DIGITAL, i));
+    REQUIRE(DCS_GetGolayCodeWord(CODE_TYPE_REVERSE_DIGITAL, i) == old::DCS_GetGolayCodeWord(CODE_TYPE_REVERSE_DIGITAL, i));
+  }
+}
+
+
+TEST_CASE("DCS_GetCdcssCode, codewords", "[dcs]" ) {
+  // Every rotation of a normal codeword decodes to its own option and every
+  // rotation of an inverted one to some option
+  for (uint8_t i = 0; i < ARRAY_SIZE(DCS_Options); i++) {
+    uint32_t Normal = DCS_GetGolayCodeWord(CODE_TYPE_DIGITAL, i);
+    uint32_t Inverted = DCS_GetGolayCodeWord(CODE_TYPE_REVERSE_DIGITAL, i);
+
+    for (uint8_t j = 0; j < 23; j++) {
+      REQUIRE(DCS_GetCdcssCode(Normal) == i);
+      REQUIRE(DCS_GetCdcssCode(Inverted) != 0xFF);
+      Normal = (Normal >> 1) | ((Normal & 1U) << 22);
+      Inverted = (Inverted >> 1) | ((Inverted & 1U) << 22);
+    }
+  }
+}
+
+
+TEST_CASE("DCS_GetCdcssCode, all 2^24 words", "[dcs]" ) {
+  uint32_t Mismatch23 = 0;
+  uint32_t Mismatch24 = 0;
+
+  for (uint8_t i = 0; i < ARRAY_SIZE(DCS_Options); i++) {
+    old::CodeWords[i] = old::DCS_CalculateGolay(DCS_Options[i] + 0x800U);
+  }
+
+  for (uint32_t Code = 0; Code < 0x1000000U; Code++) {
+    const uint8_t Old = old::DCS_GetCdcssCode(Code);
+    const uint8_t New = DCS_GetCdcssCode(Code);
+
+    if (Old == New) {
+      continue;
+    }
+    if (Code < 0x800000U) {
+      Mismatch23++;
+      continue;
+    }
+    // Bit 23 set: the old scan gave up one rotation before the codeword,
+    // the new lookup decodes it
+    Mismatch24++;
+    REQUIRE(Old == 0xFF);
+    REQUIRE(New == old::DCS_GetCdcssCode((Code >> 1) | ((Code & 1U) << 22)));
+  }
+
+  REQUIRE(Mismatch23 == 0U);
+  REQUIRE(Mismatch24 == 104U);
+}
@@ -0,0 +1,225 @@
+/* Copyright 2025 muzkr https://github.com/muzkr
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+// Checks the reciprocal multiplies of App/helper/fixed.h where the firmware
+// uses them against the divisions they replaced. A program of its own, like
+// test_lookup:
+//
+//   make APP=test_fixed C_INCLUDES="-I../../App -I../../K5_Driver"
+//        FILES_PRJ="test/test_fixed ../../App/misc ../../App/frequencies ../../App/helper/fixed ../../App/helper/battery"
+//   bin/test_fixed    (the sweeps take a minute or two)
+//
+// The C files link only into the main binary; the Makefile's .c rule builds
+// no coverage objects, so the coverage link fails harmlessly.
+
+// no POSIX signals, as in test_suite.cpp
+#define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_NO_POSIX_SIGNALS
+#include "catch.hpp"
+
+#include <limits.h>
+#include <stdint.h>
+#include <string.h>
+
+extern "C" {
+  #include "frequencies.h"
+  #include "helper/battery.h"
+  #include "misc.h"
+  #include "ui/ui.h"
+
+  // What battery.c links against besides the conversion
+  static uint16_t gAdcVoltage;
+
+  void BOARD_ADC_GetBatteryAverage(uint16_t *pVoltage, uint16_t *pCurrent)
+  {
+    *pVoltage = gAdcVoltage;
+    *pCurrent = 1000U;
+  }
+
+  void BACKLIGHT_TurnOn(void)
+  {
+  }
+
+  void UI_DisplayBattery(uint8_t Level)
+  {
+    (void)Level;
+  }
+
+  uint8_t gMenuCursor;
+  GUI_DisplayType_t gScreenToDisplay;
+}
+
+
+// The functions as they were before the reciprocals, kept as the reference
+namespace old {
+
+static void NUMBER_ToDigits(uint32_t Value, char *pDigits)
+{
+  uint8_t i;
+
+  for (i = 0; i < 8; i++) {
+    uint32_t Result = Value / 10U;
+
+    pDigits[7 - i] = static_cast<char>(Value - (Result * 10U));
+    Value = Result;
+  }
+}
+
+static uint32_t FREQUENCY_FloorToStep(uint32_t Upper, uint32_t Step, uint32_t Lower)
+{
+  uint32_t Index;
+
+  if (Step == 833) {
+    const uint32_t Delta = Upper - Lower;
+    uint32_t Base = (Delta / 2500) * 2500;
+    const uint32_t Index833 = ((Delta - Base) % 2500) / 833;
+
+    if (Index833 == 2) {
+      Base++;
+    }
+
+    return Lower + Base + (Index833 * 833);
+  }
+
+  Index = (Upper - Lower) / Step;
+
+  return Lower + (Step * Index);
+}
+
+static uint8_t FREQUENCY_CalculateOutputPower(uint8_t TxpLow, uint8_t TxpMid, uint8_t TxpHigh, int32_t LowerLimit, int32_t Middle, int32_t UpperLimit, int32_t Frequency)
+{
+  if (Frequency <= LowerLimit) {
+    return TxpLow;
+  }
+  if (UpperLimit <= Frequency) {
+    return TxpHigh;
+  }
+  // The old code multiplied in int32_t, which overflows for the widest
+  // spans and large calibration steps. Where it did, the reference is the
+  // exact product, which is what the reciprocal version computes.
+  if (Frequency <= Middle) {
+    const int64_t Product = static_cast<int64_t>(TxpMid - TxpLow) * (Frequency - LowerLimit);
+
+    if (Product > INT32_MAX || Product < INT32_MIN) {
+      return static_cast<uint8_t>(TxpMid + Product / (Middle - LowerLimit));
+    }
+    TxpMid = static_cast<uint8_t>(TxpMid + ((TxpMid - TxpLow) * (Frequency - LowerLimit)) / (Middle - LowerLimit));
+    return TxpMid;
+  }
+
+  const int64_t Product = static_cast<int64_t>(TxpHigh - TxpMid) * (Frequency - Middle);
+
+  if (Product > INT32_MAX || Product < INT32_MIN) {
+    return static_cast<uint8_t>(TxpMid + Product / (UpperLimit - Middle));
+  }
+  TxpMid = static_cast<uint8_t>(TxpMid + ((TxpHigh - TxpMid) * (Frequency - Middle)) / (UpperLimit - Middle));
+  return TxpMid;
+}
+
+} // namespace old
+
+
+TEST_CASE("NUMBER_ToDigits, all 2^32 values", "[fixed]" ) {
+  uint32_t Mismatches = 0U;
+  uint32_t Value = 0U;
+
+  do {
+    char Expected[8];
+    char Digits[8];
+
+    old::NUMBER_ToDigits(Value, Expected);
+    NUMBER_ToDigits(Value, Digits);
+    Mismatches += memcmp(Digits, Expected, sizeof(Digits)) != 0;
+  } while (++Value != 0U);
+
+  REQUIRE(Mismatches == 0U);
+}
+
+
+TEST_CASE("FREQUENCY_FloorToStep", "[fixed]" ) {
+  // Every distance below 2^27, 1342 MHz, for every step. The lower end only
+  // shifts the result, so a few of them are enough.
+  static const uint32_t Lowers[] = { 0U, 5000000U, 43312500U };
+  uint32_t Mismatches = 0U;
+
+  for (uint8_t i = 0; i < ARRAY_SIZE(StepFrequencyTable); i++) {
+    const uint32_t Step = StepFrequencyTable[i];
+
+    for (uint32_t Delta = 0U; Delta < (1U << 27); Delta++) {
+      const uint32_t Lower = Lowers[Delta % ARRAY_SIZE(Lowers)];
+
+      Mismatches += FREQUENCY_FloorToStep(Lower + Delta, Step, Lower) != old::FREQUENCY_FloorToStep(Lower + Delta, Step, Lower);
+    }
+  }
+
+  REQUIRE(Mismatches == 0U);
+}
+
+
+TEST_CASE("battery voltage", "[fixed]" ) {
+  // Every calibration against every 12 bit ADC reading, through the real
+  // BATTERY_GetReadings(), which rebuilds its reciprocal on each change
+  uint32_t Mismatches = 0U;
+
+  for (uint32_t Calibration = 1U; Calibration < 0x10000U; Calibration++) {
+    gBatteryCalibration[3] = static_cast<uint16_t>(Calibration);
+    for (uint32_t Voltage = 0U; Voltage < 4096U; Voltage++) {
+      gAdcVoltage = static_cast<uint16_t>(Voltage);
+      BATTERY_GetReadings(false);
+      Mismatches += gBatteryVoltageAverage != static_cast<uint16_t>((Voltage * 760U) / Calibration);
+    }
+  }
+
+  REQUIRE(Mismatches == 0U);
+}
+
+
+TEST_CASE("FREQUENCY_CalculateOutputPower", "[fixed]" ) {
+  // Every band at both sides of each of its three points and at 4096 steps
+  // across it, with a grid of calibration bytes that runs both ways
+  uint32_t Mismatches = 0U;
+
+  for (uint8_t Band = 0; Band < 7; Band++) {
+    const uint32_t Lower = LowerLimitFrequencyBandTable[Band];
+    const uint32_t Middle = MiddleFrequencyBandTable[Band];
+    const uint32_t Upper = UpperLimitFrequencyBandTable[Band];
+    uint32_t Frequencies[4096 + 9] = {
+      Lower - 1U, Lower, Lower + 1U, Middle - 1U, Middle, Middle + 1U, Upper - 1U, Upper, Upper + 1U
+    };
+
+    for (uint32_t i = 0U; i < 4096U; i++) {
+      Frequencies[9 + i] = Lower + static_cast<uint32_t>((static_cast<uint64_t>(Upper - Lower) * i) / 4096U);
+    }
+
+    for (uint32_t Frequency : Frequencies) {
+      for (uint32_t Low = 0U; Low < 256U; Low += 17U) {
+        for (uint32_t Mid = 0U; Mid < 256U; Mid += 17U) {
+          for (uint32_t High = 0U; High < 256U; High += 17U) {
+            const uint8_t New = FREQUENCY_CalculateOutputPower(
+              static_cast<uint8_t>(Low), static_cast<uint8_t>(Mid), static_cast<uint8_t>(High),
+              static_cast<FREQUENCY_Band_t>(Band), Frequency);
+            const uint8_t Old = old::FREQUENCY_CalculateOutputPower(
+              static_cast<uint8_t>(Low), static_cast<uint8_t>(Mid), static_cast<uint8_t>(High),
+              static_cast<int32_t>(Lower), static_cast<int32_t>(Middle), static_cast<int32_t>(Upper), static_cast<int32_t>(Frequency));
+
+            Mismatches += New != Old;
+          }
+        }
+      }
+    }
+  }
+
+  REQUIRE(Mismatches == 0U);
+}
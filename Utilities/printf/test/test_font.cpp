@@ -0,0 +1,210 @@
+/* Copyright 2025 muzkr https://github.com/muzkr
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+// Checks that the packed big fonts of App/font.c draw the same frame buffer
+// as the plain bitmaps in font_plain.c did with memcpy(), and times the two.
+// A program of its own, like test_format:
+//
+//   make APP=test_font FILES_PRJ=test/test_font C_INCLUDES="-I../../App -I../../K5_Driver"
+//   bin/test_font              (checks)
+//   bin/test_font "[bench]"    (timings)
+
+// no POSIX signals, as in test_suite.cpp
+#define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_NO_POSIX_SIGNALS
+#include "catch.hpp"
+
+#include <stdint.h>
+#include <string.h>
+
+extern "C" {
+  #include "font.c"
+  #include "helper/fixed.c"
+  #include "helper/format.c"
+  #include "ui/helper.c"
+
+  uint8_t gFrameBuffer[7][128];
+  char gInputBox[8];
+  uint8_t gInputBoxIndex;
+}
+
+namespace plain {
+  #include "font_plain.c"
+
+  // UI_PrintString() and UI_DisplayFrequency() as they were before packing
+
+  static void PrintString(const char *pString, uint8_t Start, uint8_t End, uint8_t Line, uint8_t Width, bool bCentered)
+  {
+    uint32_t i, Length;
+
+    Length = strlen(pString);
+    if (bCentered) {
+      Start += (((End - Start) - (Length * Width)) + 1) / 2;
+    }
+    for (i = 0; i < Length; i++) {
+      if (pString[i] >= ' ' && pString[i] < 0x7F) {
+        uint8_t Index = pString[i] - ' ';
+        memcpy(gFrameBuffer[Line + 0] + (i * Width) + Start, &gFontBig[Index][0], 8);
+        memcpy(gFrameBuffer[Line + 1] + (i * Width) + Start, &gFontBig[Index][8], 8);
+      }
+    }
+  }
+
+  static void DisplayFrequency(const char *pDigits, uint8_t X, uint8_t Y, bool bDisplayLeadingZero, bool bFlag)
+  {
+    uint8_t *pFb0, *pFb1;
+    bool bCanDisplay;
+    uint8_t i;
+
+    pFb0 = gFrameBuffer[Y] + X;
+    pFb1 = pFb0 + 128;
+
+    bCanDisplay = false;
+    for (i = 0; i < 3; i++) {
+      const uint8_t Digit = pDigits[i];
+
+      if (bDisplayLeadingZero || bCanDisplay || Digit) {
+        bCanDisplay = true;
+        memcpy(pFb0 + (i * 13), gFontBigDigits[Digit] +  0, 13);
+        memcpy(pFb1 + (i * 13), gFontBigDigits[Digit] + 13, 13);
+      } else if (bFlag) {
+        pFb1 -= 6;
+        pFb0 -= 6;
+      }
+    }
+
+    pFb1[0x27] = 0x60;
+    pFb1[0x28] = 0x60;
+    pFb1[0x29] = 0x60;
+
+    for (i = 0; i < 3; i++) {
+      const uint8_t Digit = pDigits[i + 3];
+
+      memcpy(pFb0 + (i * 13) + 42, gFontBigDigits[Digit] +  0, 13);
+      memcpy(pFb1 + (i * 13) + 42, gFontBigDigits[Digit] + 13, 13);
+    }
+  }
+} // namespace plain
+
+
+static uint8_t Expected[7][128];
+
+// Both frame buffers start from the same noise so that a column written by
+// one and skipped by the other shows up
+static void fill(uint32_t seed)
+{
+  for (uint32_t i = 0U; i < sizeof(gFrameBuffer); i++) {
+    seed = seed * 1664525U + 1013904223U;
+    (&gFrameBuffer[0][0])[i] = static_cast<uint8_t>(seed >> 24);
+  }
+  memcpy(Expected, gFrameBuffer, sizeof(Expected));
+}
+
+// plain:: draws into gFrameBuffer too, so run it first and keep its result
+static void keep_expected(void)
+{
+  uint8_t Noise[7][128];
+
+  memcpy(Noise, Expected, sizeof(Noise));
+  memcpy(Expected, gFrameBuffer, sizeof(Expected));
+  memcpy(gFrameBuffer, Noise, sizeof(Noise));
+}
+
+
+TEST_CASE("UI_PrintString", "[font]" ) {
+  char String[17];
+
+  // Every printable character in every slot of a line, at each width the UI
+  // uses, plus a character outside the font that must be skipped
+  for (uint32_t First = 0U; First < 96U; First++) {
+    for (uint8_t Width = 6U; Width <= 8U; Width++) {
+      for (uint32_t i = 0U; i < 14U; i++) {
+        String[i] = static_cast<char>(' ' + ((First + i) % 96U));
+      }
+      String[14] = '\0';
+
+      fill(First * 8U + Width);
+      plain::PrintString(String, 2U, 127U, 2U, Width, false);
+      keep_expected();
+      UI_PrintString(String, 2U, 127U, 2U, Width, false);
+      REQUIRE(!memcmp(gFrameBuffer, Expected, sizeof(Expected)));
+
+      String[5] = '\0';
+      fill(First * 8U + Width + 1U);
+      plain::PrintString(String, 0U, 127U, 4U, Width, true);
+      keep_expected();
+      UI_PrintString(String, 0U, 127U, 4U, Width, true);
+      REQUIRE(!memcmp(gFrameBuffer, Expected, sizeof(Expected)));
+    }
+  }
+}
+
+
+TEST_CASE("UI_DisplayFrequency", "[font]" ) {
+  char Digits[6];
+
+  // Each digit, including the dash, in each position, with and without the
+  // leading zeros and the shift they leave behind
+  for (uint32_t i = 0U; i < 6U * 11U * 11U; i++) {
+    for (uint32_t j = 0U; j < 6U; j++) {
+      Digits[j] = static_cast<char>((i / 11U + j * 7U) % 11U);
+    }
+    Digits[i % 6U] = static_cast<char>(i % 11U);
+    if (i & 1U) {
+      Digits[0] = 0;
+    }
+
+    for (uint32_t Mode = 0U; Mode < 4U; Mode++) {
+      const bool bLeadingZero = Mode & 1U;
+      const bool bFlag = Mode & 2U;
+
+      fill(i * 4U + Mode);
+      plain::DisplayFrequency(Digits, 24U, 1U + (i % 5U), bLeadingZero, bFlag);
+      keep_expected();
+      UI_DisplayFrequency(Digits, 24U, 1U + (i % 5U), bLeadingZero, bFlag);
+      REQUIRE(!memcmp(gFrameBuffer, Expected, sizeof(Expected)));
+    }
+  }
+}
+
+
+TEST_CASE("memcpy vs packed glyphs", "[.][bench]" ) {
+  // A main screen redraw: two 16 character lines and two frequencies
+  static const char Line[] = "CH-001 TEST LINE";
+  static const char Frequency[6] = { 4, 3, 3, 1, 2, 5 };
+  uint32_t sink = 0U;
+
+  BENCHMARK("memcpy") {
+    for (uint32_t i = 0U; i < 10000U; i++) {
+      plain::PrintString(Line, 0U, 127U, 1U, 8U, false);
+      plain::PrintString(Line, 0U, 127U, 5U, 8U, false);
+      plain::DisplayFrequency(Frequency, 32U, 0U, false, true);
+      plain::DisplayFrequency(Frequency, 32U, 4U, false, true);
+      sink += gFrameBuffer[i % 7U][i % 128U];
+    }
+  }
+
+  BENCHMARK("DrawGlyph") {
+    for (uint32_t i = 0U; i < 10000U; i++) {
+      UI_PrintString(Line, 0U, 127U, 1U, 8U, false);
+      UI_PrintString(Line, 0U, 127U, 5U, 8U, false);
+      UI_DisplayFrequency(Frequency, 32U, 0U, false, true);
+      UI_DisplayFrequency(Frequency, 32U, 4U, false, true);
+      sink += gFrameBuffer[i % 7U][i % 128U];
+    }
+  }
+
+  REQUIRE(sink != 0U);
+}
@@ -0,0 +1,172 @@
+/* Copyright 2025 muzkr https://github.com/muzkr
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+// Checks App/helper/format.c against snprintf_() and times the two.
+// A program of its own, built with the Makefile next to this directory:
+//
+//   make APP=test_format FILES_PRJ=test/test_format C_INCLUDES=-I../../App
+//   bin/test_format              (checks)
+//   bin/test_format "[bench]"    (timings)
+
+// no POSIX signals, as in test_suite.cpp
+#define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_NO_POSIX_SIGNALS
+#include "catch.hpp"
+
+#include <stdint.h>
+#include <string.h>
+
+namespace test {
+  // own namespace, like test_suite.cpp, to stay clear of stdio
+  #include "../printf.h"
+  #include "../printf.c"
+} // namespace test
+
+extern "C" {
+  #include "helper/format.h"
+  #include "helper/format.c"
+}
+
+
+void test::_putchar(char character)
+{
+  (void)character;
+}
+
+
+// Values every formatter sees: the edges of each digit count and block of
+// four, plus a spread of pseudo random ones
+static uint32_t test_value(uint32_t i)
+{
+  static const uint32_t edges[] = {
+    0U, 1U, 9U, 10U, 99U, 100U, 999U, 1000U, 9999U, 10000U, 10001U, 99999U,
+    100000U, 999999U, 1000000U, 9999999U, 10000000U, 99999999U, 100000000U,
+    999999999U, 1000000000U, 2147483647U, 2147483648U, 4294967295U
+  };
+  const uint32_t count = sizeof(edges) / sizeof(edges[0]);
+
+  if (i < count) {
+    return edges[i];
+  }
+  return (i * 2654435761U) >> (i % 32U);
+}
+
+
+TEST_CASE("FORMAT_Decimal", "[format]" ) {
+  char expected[32];
+  char buffer[32];
+
+  for (uint32_t i = 0U; i < 200000U; i++) {
+    const uint32_t value = test_value(i);
+    const uint8_t width = static_cast<uint8_t>(i % 5U);
+    char *end;
+
+    test::snprintf_(expected, sizeof(expected), "%0*u", width, value);
+    end = FORMAT_Decimal(buffer, value, width);
+    REQUIRE(!strcmp(buffer, expected));
+    REQUIRE(end == buffer + strlen(expected));
+  }
+}
+
+
+TEST_CASE("FORMAT_Hex", "[format]" ) {
+  char expected[32];
+  char buffer[32];
+
+  for (uint32_t i = 0U; i < 100000U; i++) {
+    const uint32_t value = test_value(i);
+
+    test::snprintf_(expected, sizeof(expected), "%08X", value);
+    FORMAT_Hex(buffer, value, 8U);
+    REQUIRE(!strcmp(buffer, expected));
+    test::snprintf_(expected, sizeof(expected), "%04X", value & 0xFFFFU);
+    FORMAT_Hex(buffer, value, 4U);
+    REQUIRE(!strcmp(buffer, expected));
+  }
+}
+
+
+TEST_CASE("FORMAT_Octal", "[format]" ) {
+  char expected[32];
+  char buffer[32];
+
+  for (uint32_t value = 0U; value < 01000U; value++) {
+    test::snprintf_(expected, sizeof(expected), "D%03oN", value);
+    FORMAT_String(FORMAT_Octal(FORMAT_String(buffer, "D"), value, 3U), "N");
+    REQUIRE(!strcmp(buffer, expected));
+  }
+}
+
+
+TEST_CASE("FORMAT_Fixed", "[format]" ) {
+  char expected[32];
+  char buffer[32];
+
+  for (uint32_t i = 0U; i < 200000U; i++) {
+    const uint32_t value = test_value(i);
+
+    // The menu and scanner frequencies
+    test::snprintf_(expected, sizeof(expected), "%u.%05u", value / 100000U, value % 100000U);
+    FORMAT_Frequency(buffer, value, 5U);
+    REQUIRE(!strcmp(buffer, expected));
+
+    // The spectrum centre, cut to 100 Hz
+    test::snprintf_(expected, sizeof(expected), "%u.%04u", value / 100000U, (value / 10U) % 10000U);
+    FORMAT_Frequency(buffer, value, 4U);
+    REQUIRE(!strcmp(buffer, expected));
+
+    // Voltages and steps
+    test::snprintf_(expected, sizeof(expected), "%u.%02u", value / 100U, value % 100U);
+    FORMAT_Fixed(buffer, value, 2U, 2U);
+    REQUIRE(!strcmp(buffer, expected));
+
+    // CTCSS tones
+    test::snprintf_(expected, sizeof(expected), "%u.%u", value / 10U, value % 10U);
+    FORMAT_Fixed(buffer, value, 1U, 1U);
+    REQUIRE(!strcmp(buffer, expected));
+  }
+}
+
+
+TEST_CASE("format vs snprintf_", "[.][bench]" ) {
+  // Each loop pass is a channel number, a frequency and a DTMF string, the
+  // kind of text a main screen redraw builds
+  char buffer[32];
+  uint32_t sink = 0U;
+
+  BENCHMARK("snprintf_") {
+    for (uint32_t i = 0U; i < 10000U; i++) {
+      test::snprintf_(buffer, sizeof(buffer), "CH-%03d", static_cast<int>(i % 200U) + 1);
+      sink += static_cast<uint8_t>(buffer[5]);
+      test::snprintf_(buffer, sizeof(buffer), "%lu.%05lu", 43312500UL / 100000UL, 43312500UL % 100000UL);
+      sink += static_cast<uint8_t>(buffer[4]);
+      test::snprintf_(buffer, sizeof(buffer), ">%s", "123*456");
+      sink += static_cast<uint8_t>(buffer[1]);
+    }
+  }
+
+  BENCHMARK("FORMAT_*") {
+    for (uint32_t i = 0U; i < 10000U; i++) {
+      FORMAT_Decimal(FORMAT_String(buffer, "CH-"), (i % 200U) + 1U, 3U);
+      sink += static_cast<uint8_t>(buffer[5]);
+      FORMAT_Frequency(buffer, 43312500U, 5U);
+      sink += static_cast<uint8_t>(buffer[4]);
+      FORMAT_String(FORMAT_String(buffer, ">"), "123*456");
+      sink += static_cast<uint8_t>(buffer[1]);
+    }
+  }
+
+  REQUIRE(sink != 0U);
+}
@@ -0,0 +1,124 @@
+/* Copyright 2025 muzkr https://github.com/muzkr
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+// Checks the boundary table lookups of FREQUENCY_GetBand() and
+// DCS_GetCtcssCode() against the scans they replaced, on every input.
+// A program of its own, like test_format:
+//
+//   make APP=test_lookup C_INCLUDES="-I../../App -I../../K5_Driver"
+//        FILES_PRJ="test/test_lookup ../../App/frequencies ../../App/helper/fixed"
+//   bin/test_lookup    (the 2^32 sweep takes half a minute)
+//
+// The C files link only into the main binary; the Makefile's .c rule builds
+// no coverage objects, so the coverage link fails harmlessly.
+
+// no POSIX signals, as in test_suite.cpp
+#define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_NO_POSIX_SIGNALS
+#include "catch.hpp"
+
+#include <stdint.h>
+
+extern "C" {
+  #include "dcs.c"
+  #include "frequencies.h"
+
+  // frequencies.c is built as C, it converts to enums implicitly. This is
+  // what it links against besides the lookups.
+  bool gSetting_350TX;
+  bool gSetting_200TX;
+  bool gSetting_500TX;
+  bool gSetting_350EN;
+  uint8_t gSetting_F_LOCK;
+}
+
+
+// The functions as they were before the tables, kept here as the reference
+namespace old {
+
+static FREQUENCY_Band_t FREQUENCY_GetBand(uint32_t Frequency)
+{
+  if (Frequency >=  5000000 && Frequency <=  7600000) {
+    return BAND1_50MHz;
+  }
+  if (Frequency >= 10800000 && Frequency <= 13599990) {
+    return BAND2_108MHz;
+  }
+  if (Frequency >= 13600000 && Frequency <= 17399990) {
+    return BAND3_136MHz;
+  }
+  if (Frequency >= 17400000 && Frequency <= 34999990) {
+    return BAND4_174MHz;
+  }
+  if (Frequency >= 35000000 && Frequency <= 39999990) {
+    return BAND5_350MHz;
+  }
+  if (Frequency >= 40000000 && Frequency <= 46999990) {
+    return BAND6_400MHz;
+  }
+  if (Frequency >= 47000000 && Frequency <= 60000000) {
+    return BAND7_470MHz;
+  }
+
+  return BAND6_400MHz;
+}
+
+static uint8_t DCS_GetCtcssCode(uint16_t Code)
+{
+  uint8_t i;
+  int Smallest;
+  uint8_t Result = 0xFF;
+
+  Smallest = ARRAY_SIZE(CTCSS_Options);
+  for (i = 0; i < ARRAY_SIZE(CTCSS_Options); i++) {
+    int Delta;
+
+    Delta = Code - CTCSS_Options[i];
+    if (Delta < 0) {
+      Delta = -(Code - CTCSS_Options[i]);
+    }
+    if (Delta < Smallest) {
+      Smallest = Delta;
+      Result = i;
+    }
+  }
+
+  return Result;
+}
+
+} // namespace old
+
+
+TEST_CASE("FREQUENCY_GetBand, all 2^32 frequencies", "[lookup]" ) {
+  uint32_t Mismatches = 0U;
+  uint32_t Frequency = 0U;
+
+  do {
+    Mismatches += FREQUENCY_GetBand(Frequency) != old::FREQUENCY_GetBand(Frequency);
+  } while (++Frequency != 0U);
+
+  REQUIRE(Mismatches == 0U);
+}
+
+
+TEST_CASE("DCS_GetCtcssCode, all 65536 codes", "[lookup]" ) {
+  uint32_t Mismatches = 0U;
+
+  for (uint32_t Code = 0U; Code < 0x10000U; Code++) {
+    Mismatches += DCS_GetCtcssCode(static_cast<uint16_t>(Code)) != old::DCS_GetCtcssCode(static_cast<uint16_t>(Code));
+  }
+
+  REQUIRE(Mismatches == 0U);
+}
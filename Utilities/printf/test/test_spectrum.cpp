@@ -0,0 +1,284 @@
+/* Copyright 2025 muzkr https://github.com/muzkr
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+// Runs the band scope of App/app/spectrum.c against a simulated BK4819: the
+// sweep order, the RSSI it collects, the band edge clamp and, in "[bench]",
+// the sweep rate. A program of its own, like test_format:
+//
+//   make APP=test_spectrum FILES_PRJ=test/test_spectrum C_INCLUDES="-I../../App -I../../K5_Driver" C_DEFINES=-DENABLE_SPECTRUM
+//   bin/test_spectrum              (checks)
+//   bin/test_spectrum "[bench]"    (timings)
+
+// no POSIX signals, as in test_suite.cpp
+#define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_NO_POSIX_SIGNALS
+#include "catch.hpp"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <stdint.h>
+#include <vector>
+
+extern "C" {
+  #include "app/spectrum.c"
+
+  // The band edges the scope is clamped to, as in App/frequencies.c
+  const uint32_t LowerLimitFrequencyBandTable[7] = { 5000000, 10800000, 13600000, 17400000, 35000000, 40000000, 47000000 };
+  const uint32_t UpperLimitFrequencyBandTable[7] = { 7600000, 13599990, 17399990, 34999990, 39999990, 46999990, 60000000 };
+
+  bool gUpdateDisplay;
+  bool gFlagReconfigureVfos;
+  GUI_DisplayType_t gRequestDisplayScreen;
+  VFO_Info_t *gRxVfo;
+}
+
+
+// The simulated chip. Register accesses cost bus time like the bit-banged
+// driver (K5_Driver/driver/bk4819.c, 1 us per half clock) and the RSSI is
+// only valid once SETTLE_US have passed since the last RX link restart.
+namespace sim {
+
+static const double WRITE_US = 76.0;
+static const double READ_US = 58.0;
+static const double SETTLE_US = 600.0;
+
+static double Now;
+static double Restart;
+static uint32_t Frequency;
+static uint32_t Writes;
+static uint32_t Unsettled;
+static std::vector<uint32_t> Tuned;
+
+// A few carriers over a noise floor
+static uint16_t Level(uint32_t f)
+{
+  switch (f % 1000000U) {
+  case 0U:      return 180U;
+  case 500000U: return 120U;
+  default:      return 40U + (f / 2500U) % 8U;
+  }
+}
+
+static void reset(void)
+{
+  Now = 0.0;
+  Restart = 0.0;
+  Writes = 0U;
+  Unsettled = 0U;
+  Tuned.clear();
+}
+
+} // namespace sim
+
+extern "C" {
+
+void BK4819_WriteRegister(BK4819_REGISTER_t Register, uint16_t Data)
+{
+  sim::Now += sim::WRITE_US;
+  sim::Writes++;
+  if (Register == BK4819_REG_38) {
+    sim::Frequency = (sim::Frequency & 0xFFFF0000U) | Data;
+  } else if (Register == BK4819_REG_39) {
+    sim::Frequency = (sim::Frequency & 0xFFFFU) | (static_cast<uint32_t>(Data) << 16);
+  } else if (Register == BK4819_REG_30 && (Data & 0x8000U)) {
+    sim::Restart = sim::Now;
+    sim::Tuned.push_back(sim::Frequency);
+  }
+}
+
+// As in the driver
+void BK4819_RetuneRX(uint32_t Frequency)
+{
+  BK4819_WriteRegister(BK4819_REG_38, (Frequency >> 0) & 0xFFFF);
+  BK4819_WriteRegister(BK4819_REG_39, (Frequency >> 16) & 0xFFFF);
+  BK4819_WriteRegister(BK4819_REG_30, 0);
+  BK4819_WriteRegister(BK4819_REG_30, 0xBFF1);
+}
+
+// Two BK4819_ToggleGpioOut() calls
+void BK4819_SelectFilter(uint32_t Frequency)
+{
+  (void)Frequency;
+  BK4819_WriteRegister(BK4819_REG_33, 0);
+  BK4819_WriteRegister(BK4819_REG_33, 0);
+}
+
+uint16_t BK4819_GetRSSI(void)
+{
+  sim::Now += sim::READ_US;
+  if (sim::Now - sim::Restart < sim::SETTLE_US) {
+    sim::Unsettled++;
+    return 0U;
+  }
+  return sim::Level(sim::Frequency);
+}
+
+void BK4819_SetAF(BK4819_AF_Type_t AF)
+{
+  (void)AF;
+}
+
+void SYSTICK_DelayUs(uint32_t Delay)
+{
+  sim::Now += Delay;
+}
+
+void RADIO_SelectVfos(void)
+{
+}
+
+void RADIO_SetupRegisters(bool bSwitchToFunction0)
+{
+  (void)bSwitchToFunction0;
+}
+
+} // extern "C"
+
+
+static void press(KEY_Code_t Key)
+{
+  SPECTRUM_ProcessKeys(Key, true, false);
+}
+
+// Step and dwell are kept between runs, so every test picks its own
+static void start(uint32_t Center, uint8_t StepIndex, uint8_t DwellIndex)
+{
+  static VFO_Info_t Vfo;
+
+  Vfo.pRX = &Vfo.ConfigRX;
+  Vfo.ConfigRX.Frequency = Center;
+  gRxVfo = &Vfo;
+  SPECTRUM_Start();
+  for (uint8_t i = 0; i < ARRAY_SIZE(StepTable); i++) {
+    press(KEY_7);
+  }
+  for (uint8_t i = 0; i < StepIndex; i++) {
+    press(KEY_1);
+  }
+  for (uint8_t i = 0; i < ARRAY_SIZE(DwellTable); i++) {
+    press(KEY_9);
+  }
+  for (uint8_t i = 0; i < DwellIndex; i++) {
+    press(KEY_3);
+  }
+  sim::reset();
+}
+
+static void sweep(void)
+{
+  for (uint32_t i = 0U; i < SPECTRUM_POINTS; i++) {
+    SPECTRUM_Update();
+  }
+}
+
+
+TEST_CASE("sweep order and RSSI", "[spectrum]" ) {
+  start(14500000U, 2U, 2U);
+  REQUIRE(SPECTRUM_GetStep() == 2500U);
+
+  sweep();
+  sweep();
+  REQUIRE(sim::Tuned.size() == 2U * SPECTRUM_POINTS);
+  for (uint32_t i = 0U; i < 2U * SPECTRUM_POINTS; i++) {
+    REQUIRE(sim::Tuned[i] == 14500000U - (SPECTRUM_POINTS / 2) * 2500U + (i % SPECTRUM_POINTS) * 2500U);
+  }
+  // 1200 us of dwell is well past the settle time
+  REQUIRE(sim::Unsettled == 0U);
+  for (uint32_t i = 0U; i < SPECTRUM_POINTS; i++) {
+    REQUIRE(gSpectrumRssi[i] == sim::Level(sim::Tuned[i]) >> 1);
+    REQUIRE(gSpectrumPeak[i] == gSpectrumRssi[i]);
+  }
+
+  // The LNA path is only switched where the sweep crosses 280 MHz
+  start(28000000U, 2U, 2U);
+  sweep();
+  REQUIRE(sim::Writes == 4U * SPECTRUM_POINTS + 2U);
+}
+
+
+TEST_CASE("band edge clamp", "[spectrum]" ) {
+  const uint32_t Lower = LowerLimitFrequencyBandTable[0];
+  const uint32_t Upper = UpperLimitFrequencyBandTable[6];
+
+  for (uint8_t Step = 0; Step < ARRAY_SIZE(StepTable); Step++) {
+    start(Lower, Step, 0U);
+    for (uint32_t i = 0U; i < 200U; i++) {
+      press(KEY_DOWN);
+    }
+    sim::reset();
+    sweep();
+    REQUIRE(sim::Tuned.front() == Lower);
+
+    start(Upper, Step, 0U);
+    for (uint32_t i = 0U; i < 200U; i++) {
+      press(KEY_UP);
+    }
+    sim::reset();
+    sweep();
+    REQUIRE(sim::Tuned.back() <= Upper);
+    REQUIRE(sim::Tuned.back() + 2U * StepTable[Step] > Upper);
+  }
+
+  // Widening the span next to an edge pulls the centre in
+  start(Lower, 0U, 0U);
+  for (uint8_t i = 0; i < ARRAY_SIZE(StepTable); i++) {
+    press(KEY_1);
+  }
+  sim::reset();
+  sweep();
+  REQUIRE(sim::Tuned.front() == Lower);
+}
+
+
+TEST_CASE("sweep rate", "[.][bench]" ) {
+  // Per 10 ms tick of the main loop: key scan, counters, status. After each
+  // sweep the screen is redrawn and blitted.
+  const double TIMESLICE_US = 300.0;
+  const double BLIT_US = 2500.0;
+  const uint32_t Sweeps = 20U;
+
+  std::cout << "simulated BK4819, RSSI settles after " << sim::SETTLE_US << " us" << std::endl;
+  std::cout << "dwell us  points/s  sweeps/s  writes/pt  unsettled  host ns/pt" << std::endl;
+  for (uint8_t Dwell = 0; Dwell < ARRAY_SIZE(DwellTable); Dwell++) {
+    double NextTick = 10000.0;
+
+    start(43300000U, 2U, Dwell);
+    const auto Begin = std::chrono::steady_clock::now();
+    for (uint32_t s = 0U; s < Sweeps; s++) {
+      for (uint32_t i = 0U; i < SPECTRUM_POINTS; i++) {
+        SPECTRUM_Update();
+        while (sim::Now >= NextTick) {
+          sim::Now += TIMESLICE_US;
+          NextTick += 10000.0;
+        }
+      }
+      sim::Now += BLIT_US;
+    }
+    const auto End = std::chrono::steady_clock::now();
+    const double Points = static_cast<double>(Sweeps * SPECTRUM_POINTS);
+    const double HostNs = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(End - Begin).count());
+    const double Rate = Points / (sim::Now / 1e6);
+
+    std::cout << std::fixed << std::setprecision(0)
+      << std::setw(8) << DwellTable[Dwell]
+      << std::setw(10) << Rate
+      << std::setprecision(2) << std::setw(10) << Rate / SPECTRUM_POINTS
+      << std::setw(11) << sim::Writes / Points
+      << std::setw(11) << sim::Unsettled
+      << std::setprecision(1) << std::setw(12) << HostNs / Points << std::endl;
+  }
+  REQUIRE(sim::Tuned.size() == Sweeps * SPECTRUM_POINTS);
+}
@@ -27,12 +27,24 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 // use the 'catch' test framework
+// (no POSIX signals: this Catch version does not build against glibc 2.34+)
 #define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_NO_POSIX_SIGNALS
 #include "catch.hpp"
 
 #include <string.h>
 #include <sstream>
 #include <math.h>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+// printf.h leaves these aliases to the build, see App/CMakeLists.txt
+#define printf    printf_
+#define sprintf   sprintf_
+#define snprintf  snprintf_
+#define vsnprintf vsnprintf_
+#define vprintf   vprintf_
 
 namespace test {
   // use functions in own test namespace to avoid stdio conflicts
@@ -50,6 +62,15 @@ void test::_putchar(char character)
   printf_buffer[printf_idx++] = character;
 }
 
+#if (PRINTF_OUTPUT_BUFFER_SIZE > 0U)
+void test::_putbuffer(const char* buffer, size_t count)
+{
+  while (count--) {
+    printf_buffer[printf_idx++] = *(buffer++);
+  }
+}
+#endif
+
 void _out_fct(char character, void* arg)
 {
   (void)arg;
@@ -1510,3 +1531,72 @@ TEST_CASE("misc", "[]" ) {
   REQUIRE(!strcmp(buffer, "3.33e-01"));
 #endif
 }
+
+
+///////////////////////////////////////////////////////////////////////////////
+// benchmark, not part of the default run:
+//   make bench                                    (fast paths)
+//   make bench C_DEFINES=-DPRINTF_DISABLE_FAST_PATH
+// prints ns per call for format strings the firmware uses
+
+template <typename F>
+static void bench(const char* name, F call)
+{
+  const unsigned int calls = 200000U;
+  const auto start = std::chrono::steady_clock::now();
+  for (unsigned int i = 0U; i < calls; i++) {
+    call(i);
+  }
+  const auto stop = std::chrono::steady_clock::now();
+  const double ns = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count());
+  std::cout << std::left << std::setw(24) << name << std::right << std::setw(10) << std::fixed << std::setprecision(1) << ns / calls << " ns/call" << std::endl;
+}
+
+
+TEST_CASE("benchmark", "[.][bench]" ) {
+  char buffer[32];
+  volatile unsigned int sink = 0U;
+
+#if defined(PRINTF_SUPPORT_FAST_PATH)
+  std::cout << "fast paths" << std::endl;
+#else
+  std::cout << "plain formatter" << std::endl;
+#endif
+
+  bench("CH-%03d", [&](unsigned int i) {
+    test::sprintf(buffer, "CH-%03d", static_cast<int>(i % 200U) + 1);
+    sink += static_cast<unsigned char>(buffer[5]);
+  });
+  bench("%ld.%05ld", [&](unsigned int i) {
+    const long f = 43312500L + static_cast<long>(i);
+    test::sprintf(buffer, "%ld.%05ld", f / 100000L, f % 100000L);
+    sink += static_cast<unsigned char>(buffer[4]);
+  });
+  bench("%d.%02dV", [&](unsigned int i) {
+    test::sprintf(buffer, "%d.%02dV", static_cast<int>(i % 900U) / 100, static_cast<int>(i % 100U));
+    sink += static_cast<unsigned char>(buffer[2]);
+  });
+  bench("D%03oN", [&](unsigned int i) {
+    test::sprintf(buffer, "D%03oN", i & 0777U);
+    sink += static_cast<unsigned char>(buffer[3]);
+  });
+  bench("%s%c%s", [&](unsigned int i) {
+    test::sprintf(buffer, "%s%c%s", "123", '*', (i & 1U) ? "ABCD9" : "9DCBA");
+    sink += static_cast<unsigned char>(buffer[4]);
+  });
+  bench("snprintf R:%d E:%d D:%d", [&](unsigned int i) {
+    test::snprintf(buffer, 16U, "R:%d E:%d D:%d", static_cast<int>(i % 120U), static_cast<int>(i % 7U), static_cast<int>(i % 3U));
+    sink += static_cast<unsigned char>(buffer[2]);
+  });
+  bench("%08X", [&](unsigned int i) {
+    test::sprintf(buffer, "%08X", i * 2654435761U);
+    sink += static_cast<unsigned char>(buffer[7]);
+  });
+  bench("literal text only", [&](unsigned int i) {
+    (void)i;
+    test::sprintf(buffer, "VOLTAGE CALIBRATION");
+    sink += static_cast<unsigned char>(buffer[0]);
+  });
+
+  REQUIRE(sink != 0U);
+}
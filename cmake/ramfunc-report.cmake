@@ -0,0 +1,73 @@
+#    Copyright 2025 muzkr
+#
+#         https://github.com/muzkr
+#
+#    Licensed under the Apache License, Version 2.0 (the "License");
+#    you may not use this file except in compliance with the License.
+#    You may obtain a copy of the License at
+#
+#        http://www.apache.org/licenses/LICENSE-2.0
+#
+#    Unless required by applicable law or agreed to in writing, software
+#    distributed under the License is distributed on an "AS IS" BASIS,
+#    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#    See the License for the specific language governing permissions and
+#    limitations under the License.
+
+# Prints the RAM and flash cost of every function placed in .ramfunc.
+#
+# Usage: cmake -DNM=<nm> -DELF=<elf> -P ramfunc-report.cmake
+#
+# A RAM function occupies its size in RAM and the same size in flash (the
+# load image copied by the startup code), so moving it out of .text leaves
+# flash unchanged. Each call across the flash/RAM boundary additionally needs
+# a long-branch veneer, which is listed separately.
+
+execute_process(
+    COMMAND ${NM} -S -t d ${ELF}
+    OUTPUT_VARIABLE NM_OUTPUT
+    RESULT_VARIABLE NM_RESULT
+)
+if(NOT NM_RESULT EQUAL 0)
+    message(WARNING "ramfunc-report: failed to run ${NM}")
+    return()
+endif()
+
+string(REPLACE "\n" ";" NM_LINES "${NM_OUTPUT}")
+
+set(RAMFUNC_START "")
+set(RAMFUNC_END "")
+foreach(LINE IN LISTS NM_LINES)
+    if(LINE MATCHES "^([0-9]+) [A-Za-z] _sramfunc$")
+        set(RAMFUNC_START ${CMAKE_MATCH_1})
+    elseif(LINE MATCHES "^([0-9]+) [A-Za-z] _eramfunc$")
+        set(RAMFUNC_END ${CMAKE_MATCH_1})
+    endif()
+endforeach()
+
+if(RAMFUNC_START STREQUAL "" OR RAMFUNC_END STREQUAL "")
+    message(STATUS "RAM functions: none (no .ramfunc symbols)")
+    return()
+endif()
+
+math(EXPR RAMFUNC_TOTAL "${RAMFUNC_END} - ${RAMFUNC_START}")
+message(STATUS "RAM functions: ${RAMFUNC_TOTAL} bytes of RAM")
+
+set(VENEER_TOTAL 0)
+foreach(LINE IN LISTS NM_LINES)
+    if(LINE MATCHES "^([0-9]+) ([0-9]+) [Tt] (.+)$")
+        set(ADDR ${CMAKE_MATCH_1})
+        set(NAME ${CMAKE_MATCH_3})
+        math(EXPR SIZE "${CMAKE_MATCH_2}")
+        if(NAME MATCHES "_veneer$")
+            message(STATUS "  veneer   ${NAME}: flash ${SIZE}")
+            math(EXPR VENEER_TOTAL "${VENEER_TOTAL} + ${SIZE}")
+        elseif(ADDR GREATER_EQUAL RAMFUNC_START AND ADDR LESS RAMFUNC_END)
+            message(STATUS "  function ${NAME}: RAM ${SIZE}, flash ${SIZE} (load copy, moved from .text)")
+        endif()
+    elseif(LINE MATCHES "^[0-9]+ [Tt] (.+_veneer)$")
+        message(STATUS "  veneer   ${CMAKE_MATCH_1}: flash (size not recorded)")
+    endif()
+endforeach()
+
+message(STATUS "  veneers total: flash ${VENEER_TOTAL}")
@@ -0,0 +1,93 @@
+#!/usr/bin/env python3
+
+# Copyright (c) 2025 muzkr
+#
+#   https://github.com/muzkr
+#
+# Licensed under the MIT License (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at the root of this repository.
+#
+#     Unless required by applicable law or agreed to in writing, software
+#     distributed under the License is distributed on an "AS IS" BASIS,
+#     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#     See the License for the specific language governing permissions and
+#     limitations under the License.
+#
+
+# Frame count and air time of an aircopy pass over EEPROM dumps, legacy
+# protocol vs V2 (see App/app/aircopy.c).
+#
+# Usage:
+# aircopy_stats.py <dump> [<dump> ..]
+#
+# Dumps are the files written by `serialtool.py dump`; only the first
+# 0x1E00 bytes (the range aircopy sends) are used.
+
+import argparse
+
+IMAGE_SIZE = 0x1E00
+
+V1_PAYLOAD = 64
+V1_FRAME_BYTES = 72
+V2_PAYLOAD = 120
+V2_FRAME_BYTES = 128
+
+BAUD = 1200
+PREAMBLE_SYNC_BYTES = 7 + 4
+# Settle delays around each frame in BK4819_PollFSKTx, plus the 30 tick gap
+FRAME_OVERHEAD_S = 0.020 + 0.020 + 0.020 + 0.030 + 0.300
+
+
+def frame_time(frame_bytes: int) -> float:
+    return (PREAMBLE_SYNC_BYTES + frame_bytes) * 8 / BAUD + FRAME_OVERHEAD_S
+
+
+def load_image(file: str) -> bytes:
+    with open(file, "rb") as fd:
+        data = fd.read(IMAGE_SIZE)
+    if len(data) < IMAGE_SIZE:
+        raise ValueError("{}: {} bytes, need {}".format(file, len(data), IMAGE_SIZE))
+    return data
+
+
+def count_blank(data: bytes, size: int) -> int:
+    blank = bytes([0xFF]) * size
+    return sum(1 for off in range(0, IMAGE_SIZE, size) if data[off : off + size] == blank)
+
+
+def report(file: str):
+    data = load_image(file)
+
+    v1_frames = IMAGE_SIZE // V1_PAYLOAD
+    v2_total = IMAGE_SIZE // V2_PAYLOAD
+    v2_blank = count_blank(data, V2_PAYLOAD)
+    # Non-blank frames plus the closing map frame
+    v2_frames = v2_total - v2_blank + 1
+
+    v1_time = v1_frames * frame_time(V1_FRAME_BYTES)
+    v2_time = v2_frames * frame_time(V2_FRAME_BYTES)
+
+    print(file)
+    print("  legacy: {:3d} frames  {:5.1f} s".format(v1_frames, v1_time))
+    print(
+        "  V2:     {:3d} frames  {:5.1f} s  ({} of {} frames blank, -{:.0f}% frames)".format(
+            v2_frames, v2_time, v2_blank, v2_total, 100 * (1 - v2_frames / v1_frames)
+        )
+    )
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Aircopy frame statistics for EEPROM dumps")
+    ap.add_argument("files", nargs="+", help="EEPROM dump files")
+    args = ap.parse_args()
+
+    for file in args.files:
+        try:
+            report(file)
+        except (OSError, ValueError) as e:
+            print("Cannot use '{}': {}".format(file, e))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,158 @@
+#!/usr/bin/env python3
+
+# Copyright (c) 2025 muzkr
+#
+#   https://github.com/muzkr
+#
+# Licensed under the MIT License (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at the root of this repository.
+#
+#     Unless required by applicable law or agreed to in writing, software
+#     distributed under the License is distributed on an "AS IS" BASIS,
+#     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#     See the License for the specific language governing permissions and
+#     limitations under the License.
+#
+
+# Generates the DCS Golay tables in App/dcs.c and checks them against the
+# rotation scan they replace.
+#
+# Usage:
+# dcs_tables.py            print the C tables
+# dcs_tables.py --verify   equivalence check and operation counts
+#
+# --verify compares the table lookup with the old DCS_GetCdcssCode() on
+# every rotation of every normal and inverted codeword, on single bit
+# errors of them and on random words, and counts the inner loop steps of
+# both. The exhaustive check of the C functions over all 2^24 words is
+# Utilities/printf/test/test_dcs.cpp.
+
+import argparse
+import random
+import re
+from pathlib import Path
+
+DCS_C = Path(__file__).resolve().parent.parent / "App" / "dcs.c"
+MASK = 0x7FFFFF
+
+
+def load_options() -> list:
+    src = DCS_C.read_text()
+    start = src.index("DCS_Options[104]")
+    end = src.index("};", start)
+    return [int(x, 16) for x in re.findall(r"0x[0-9A-Fa-f]+", src[start:end])]
+
+
+def golay(code_word: int) -> int:
+    word = code_word
+    for _ in range(12):
+        word <<= 1
+        if word & 0x1000:
+            word ^= 0x08EA
+    return code_word | ((word & 0x0FFE) << 11)
+
+
+def rotate(code: int) -> int:
+    return (code >> 1) | ((code & 1) << 22)
+
+
+def normalize(code: int) -> int:
+    least = code
+    for _ in range(22):
+        code = rotate(code)
+        least = min(least, code)
+    return least
+
+
+def tables(options: list):
+    words = [golay(o + 0x800) for o in options]
+    parity = [w >> 12 for w in words]
+    canonical = sorted((normalize(w), i) for i, w in enumerate(words))
+    if len({c for c, _ in canonical}) != len(canonical):
+        raise ValueError("two options share a rotation class")
+    return words, parity, canonical
+
+
+def old_lookup(options: list, words: list, code: int, steps: list) -> int:
+    for _ in range(23):
+        if ((code >> 9) & 7) == 4:
+            for j, o in enumerate(options):
+                steps[0] += 1
+                if o == (code & 0x1FF):
+                    steps[0] += 12
+                    if words[j] == code:
+                        return j
+        code = (code >> 1) | ((code & 1) << 22)
+    return 0xFF
+
+
+def new_lookup(canonical: list, code: int, steps: list) -> int:
+    code = normalize(code & MASK)
+    steps[0] += 22
+    lo, hi = 0, len(canonical)
+    while lo < hi:
+        steps[0] += 1
+        mid = (lo + hi) // 2
+        if canonical[mid][0] < code:
+            lo = mid + 1
+        else:
+            hi = mid
+    if lo < len(canonical) and canonical[lo][0] == code:
+        return canonical[lo][1]
+    return 0xFF
+
+
+def print_table(ctype: str, name: str, values: list, fmt: str, per_line: int):
+    print("static const {} {}[{}] = {{".format(ctype, name, len(values)))
+    for i in range(0, len(values), per_line):
+        print("\t" + " ".join(fmt.format(v) + "," for v in values[i : i + per_line]))
+    print("};")
+
+
+def verify(options: list, words: list, canonical: list):
+    inputs = []
+    for w in words:
+        for inv in (0, MASK):
+            code = w ^ inv
+            for _ in range(23):
+                inputs.append(code)
+                for bit in range(23):
+                    inputs.append(code ^ (1 << bit))
+                code = rotate(code)
+    rng = random.Random(0)
+    inputs += [rng.getrandbits(23) for _ in range(200000)]
+
+    old_steps = [0]
+    new_steps = [0]
+    matches = 0
+    for code in inputs:
+        old = old_lookup(options, words, code, old_steps)
+        new = new_lookup(canonical, code, new_steps)
+        if old != new:
+            raise SystemExit("mismatch for {:06X}: old {} new {}".format(code, old, new))
+        matches += old != 0xFF
+    print("{} words checked, {} decoded, all equal".format(len(inputs), matches))
+    print("steps per lookup: old {:.0f}, new {:.0f}".format(old_steps[0] / len(inputs), new_steps[0] / len(inputs)))
+
+
+def main():
+    ap = argparse.ArgumentParser(description="DCS Golay tables for App/dcs.c")
+    ap.add_argument("--verify", action="store_true", help="check the tables against the rotation scan")
+    args = ap.parse_args()
+
+    options = load_options()
+    words, parity, canonical = tables(options)
+    if args.verify:
+        verify(options, words, canonical)
+        return
+
+    print_table("uint16_t", "DCS_Parity", parity, "0x{:03X}", 8)
+    print()
+    print_table("uint32_t", "DCS_Normalized", [c for c, _ in canonical], "0x{:06X}", 6)
+    print()
+    print_table("uint8_t", "DCS_NormalizedOption", [i for _, i in canonical], "{:3d}", 13)
+
+
+if __name__ == "__main__":
+    main()
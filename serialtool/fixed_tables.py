@@ -0,0 +1,162 @@
+#!/usr/bin/env python3
+
+# Copyright (c) 2025 muzkr
+#
+#   https://github.com/muzkr
+#
+# Licensed under the MIT License (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at the root of this repository.
+#
+#     Unless required by applicable law or agreed to in writing, software
+#     distributed under the License is distributed on an "AS IS" BASIS,
+#     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#     See the License for the specific language governing permissions and
+#     limitations under the License.
+#
+
+# Generates the reciprocal tables used with FIXED_Divide() (App/helper/fixed.h)
+# and estimates what they save on the Cortex-M0+.
+#
+# Usage:
+# fixed_tables.py            print the C tables
+# fixed_tables.py --bench    check the tables and print cycle estimates
+#
+# There is no instruction set simulator in the tree, so --bench uses a cost
+# model of the libgcc Thumb-1 routines instead of measured cycles:
+# __aeabi_uidiv is a shift-and-subtract loop of about 4 cycles per quotient
+# bit plus call overhead, __aeabi_lmul is three MULS and a handful of adds.
+# Both models are rough; the ratio is what matters.
+#
+# Utilities/printf/test/test_fixed.cpp checks the firmware functions that
+# use the tables against the divisions they replaced.
+
+import argparse
+import random
+import re
+from pathlib import Path
+
+ROOT = Path(__file__).resolve().parent.parent
+FREQUENCIES_C = ROOT / "App" / "frequencies.c"
+
+# Exact for every dividend below 2^FIXED_BITS, see FIXED_MakeReciprocal()
+FIXED_BITS = 31
+
+
+def make_reciprocal(divisor: int):
+    if divisor == 0:
+        return 0, 0
+    log2 = (divisor - 1).bit_length()
+    shift = FIXED_BITS + log2
+    return -(-(1 << shift) // divisor), shift
+
+
+def divide(value: int, reciprocal) -> int:
+    multiplier, shift = reciprocal
+    return (value * multiplier) >> shift
+
+
+def load_table(name: str) -> list:
+    src = FREQUENCIES_C.read_text()
+    start = src.index(name + "[")
+    end = src.index("};", start)
+    return [int(x) for x in re.findall(r"\b\d+\b", src[src.index("{", start) : end])]
+
+
+def tables():
+    steps = load_table("StepFrequencyTable")
+    lower = load_table("LowerLimitFrequencyBandTable")
+    middle = load_table("MiddleFrequencyBandTable")
+    upper = load_table("UpperLimitFrequencyBandTable")
+    return {
+        "StepReciprocalTable": steps,
+        "LowerSpanReciprocalTable": [m - l for l, m in zip(lower, middle)],
+        "UpperSpanReciprocalTable": [u - m for m, u in zip(middle, upper)],
+        "CTCSS (bk4819.c)": [1000],
+    }
+
+
+def check(divisor: int, rng: random.Random) -> int:
+    reciprocal = make_reciprocal(divisor)
+    limit = 1 << FIXED_BITS
+    values = [0, 1, divisor - 1, divisor, limit - 1]
+    values += [k * divisor + d for k in (1, 2, (limit - 1) // divisor) for d in (-1, 0, 1)]
+    values += [rng.randrange(limit) for _ in range(20000)]
+    for value in values:
+        if 0 <= value < limit and divide(value, reciprocal) != value // divisor:
+            raise SystemExit("{} / {} is off".format(value, divisor))
+    return len(values)
+
+
+def uidiv_cycles(value: int, divisor: int) -> int:
+    # Call, clz-free normalisation loop and one iteration per quotient bit
+    bits = max((value // divisor).bit_length(), 1)
+    return 20 + 2 * (value.bit_length() - divisor.bit_length() + 1) + 4 * bits
+
+
+LMUL_CYCLES = 18
+SHIFT_CYCLES = 6
+
+
+def bench(rng: random.Random):
+    checked = 0
+    for name, divisors in tables().items():
+        for divisor in divisors:
+            checked += check(divisor, rng)
+    for divisor in (10, 10000, 2065):
+        checked += check(divisor, rng)
+    # Battery: the divisor is gBatteryCalibration[3], read from EEPROM
+    for divisor in rng.sample(range(1, 1 << 16), 200):
+        checked += check(divisor, rng)
+    print("{} quotients checked against // , all exact".format(checked))
+
+    steps = tables()["StepReciprocalTable"]
+    freqs = [rng.randrange(5000000, 60000000) for _ in range(1000)]
+    old = sum(uidiv_cycles(f, s) for f in freqs for s in steps) / (len(freqs) * len(steps))
+    new = LMUL_CYCLES + SHIFT_CYCLES
+    print("FREQUENCY_FloorToStep divide:   {:4.0f} -> {:3d} cycles".format(old, new))
+
+    ctcss = [f * 2065 for f in range(670, 2626)]
+    old = sum(uidiv_cycles(v, 1000) for v in ctcss) / len(ctcss)
+    print("BK4819_SetCTCSSFrequency:       {:4.0f} -> {:3d} cycles".format(old, new))
+
+    volts = [v * 760 for v in range(1500, 2400)]
+    old = sum(uidiv_cycles(v, 2000) for v in volts) / len(volts)
+    print("BATTERY_GetReadings:            {:4.0f} -> {:3d} cycles".format(old, new))
+
+    # Eight divisions by 10 against one by 10000 and 32-bit multiplies
+    values = [rng.randrange(10000000, 60000000) for _ in range(1000)]
+    old = 0
+    for value in values:
+        for _ in range(8):
+            old += uidiv_cycles(value, 10) + 4
+            value //= 10
+    old /= len(values)
+    new = LMUL_CYCLES + SHIFT_CYCLES + 8 * 6
+    print("NUMBER_ToDigits:                {:4.0f} -> {:3d} cycles".format(old, new))
+
+
+def print_table(name: str, divisors: list):
+    print("static const FIXED_Reciprocal_t {}[{}] = {{".format(name, len(divisors)))
+    for divisor in divisors:
+        multiplier, shift = make_reciprocal(divisor)
+        print("\t{{ 0x{:08X}U, {} }}, // {}".format(multiplier, shift, divisor))
+    print("};")
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Reciprocal tables for App/helper/fixed.h")
+    ap.add_argument("--bench", action="store_true", help="check the tables and estimate cycles")
+    args = ap.parse_args()
+
+    if args.bench:
+        bench(random.Random(0))
+        return
+
+    for name, divisors in tables().items():
+        print_table(name, divisors)
+        print()
+
+
+if __name__ == "__main__":
+    main()
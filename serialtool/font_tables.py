@@ -0,0 +1,196 @@
+#!/usr/bin/env python3
+
+# Copyright (c) 2025 muzkr
+#
+#   https://github.com/muzkr
+#
+# Licensed under the MIT License (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at the root of this repository.
+#
+#     Unless required by applicable law or agreed to in writing, software
+#     distributed under the License is distributed on an "AS IS" BASIS,
+#     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#     See the License for the specific language governing permissions and
+#     limitations under the License.
+#
+
+# Packs the big fonts of App/font.c into a shared column dictionary.
+#
+# Usage:
+# font_tables.py SOURCE.c     print packed tables for the plain glyphs in SOURCE.c
+# font_tables.py --unpack     print the plain glyphs of App/font.c, for editing
+# font_tables.py --report     check App/font.c and print flash and render costs
+#
+# A big glyph is a run of columns, each two bytes: the upper and the lower
+# frame buffer line. Across gFontBig and gFontBigDigits only a couple of
+# hundred distinct columns exist, so each is stored once in gFontColumns and
+# a glyph becomes one byte per column, an index into it. Index 0 is always
+# the blank column.
+#
+# To change a glyph: --unpack into a file, edit the plain rows there, pack
+# that file and paste the output over the tables in App/font.c.
+#
+# There is no instruction set simulator in the tree, so --report estimates
+# render cycles with a cost model of Thumb-1 on the M0+: newlib's memcpy()
+# copies these unaligned runs a byte at a time after its call and alignment
+# checks, the decoder loop is three loads, two stores and the loop overhead
+# per column. Both models are rough; the ratio is what matters.
+#
+# Utilities/printf/test/test_font.cpp checks that the packed glyphs draw the
+# same frame buffer as the plain ones did and times both on the host, where
+# memcpy() is inlined and so comes out far ahead of the M0+ model.
+
+import argparse
+import re
+from pathlib import Path
+
+ROOT = Path(__file__).resolve().parent.parent
+FONT_C = ROOT / "App" / "font.c"
+
+# Name, glyph count, columns per glyph
+FONTS = [("gFontBig", 95, 8), ("gFontBigDigits", 11, 13)]
+DICTIONARY = "gFontColumns"
+
+MEMCPY_CALL_CYCLES = 20
+MEMCPY_BYTE_CYCLES = 5
+DECODE_CALL_CYCLES = 10
+DECODE_COLUMN_CYCLES = 14
+
+
+def load_tables(path: Path) -> dict:
+    src = re.sub(r"//.*", "", path.read_text())
+    tables = {}
+    for match in re.finditer(r"const uint8_t (\w+)\[(\d+)\]\[(\d+)\] = \{(.*?)\n\};", src, re.S):
+        rows = re.findall(r"\{([^{}]*)\}", match.group(4))
+        tables[match.group(1)] = [[int(x, 0) for x in re.findall(r"0x[0-9A-Fa-f]+|\d+", row)] for row in rows]
+    return tables
+
+
+def plain_columns(glyph: list, width: int) -> list:
+    return [(glyph[i], glyph[width + i]) for i in range(width)]
+
+
+def pack(plain: dict):
+    columns = [(0, 0)]
+    index = {(0, 0): 0}
+    packed = {}
+    for name, count, width in FONTS:
+        glyphs = plain[name]
+        assert len(glyphs) == count and all(len(g) == 2 * width for g in glyphs), name
+        packed[name] = []
+        for glyph in glyphs:
+            row = []
+            for column in plain_columns(glyph, width):
+                if column not in index:
+                    index[column] = len(columns)
+                    columns.append(column)
+                row.append(index[column])
+            packed[name].append(row)
+    if len(columns) > 256:
+        raise SystemExit("{} distinct columns, more than a byte can index".format(len(columns)))
+    return columns, packed
+
+
+def unpack(tables: dict) -> dict:
+    columns = tables[DICTIONARY]
+    plain = {}
+    for name, count, width in FONTS:
+        plain[name] = []
+        for row in tables[name]:
+            plain[name].append([columns[i][0] for i in row] + [columns[i][1] for i in row])
+    return plain
+
+
+def glyph_comment(name: str, i: int) -> str:
+    if name == "gFontBig":
+        c = chr(0x20 + i)
+        return "'\\{}'".format(c) if c in "'\\" else "'{}'".format(c)
+    return "'-'" if i == 10 else "'{}'".format(i)
+
+
+def hex_row(values: list) -> str:
+    return "{ " + ", ".join("0x{:02X}".format(v) for v in values) + " }"
+
+
+def print_packed(columns: list, packed: dict):
+    print("const uint8_t {}[{}][2] = {{".format(DICTIONARY, len(columns)))
+    for column in columns:
+        print("\t{},".format(hex_row(column)))
+    print("};")
+    for name, count, width in FONTS:
+        print()
+        print("const uint8_t {}[{}][{}] = {{".format(name, count, width))
+        for i, row in enumerate(packed[name]):
+            print("\t{}, // {}".format(hex_row(row), glyph_comment(name, i)))
+        print("};")
+
+
+def print_plain(plain: dict):
+    for name, count, width in FONTS:
+        print("const uint8_t {}[{}][{}] = {{".format(name, count, 2 * width))
+        for glyph in plain[name]:
+            print("\t{},".format(hex_row(glyph)))
+        print("};")
+        print()
+
+
+def memcpy_cycles(size: int) -> int:
+    return MEMCPY_CALL_CYCLES + MEMCPY_BYTE_CYCLES * size
+
+
+def decode_cycles(width: int) -> int:
+    return DECODE_CALL_CYCLES + DECODE_COLUMN_CYCLES * width
+
+
+def report():
+    tables = load_tables(FONT_C)
+    columns = [tuple(column) for column in tables[DICTIONARY]]
+    plain = unpack(tables)
+    if pack(plain) != (columns, {name: tables[name] for name, _, _ in FONTS}):
+        raise SystemExit("App/font.c does not match a fresh pack of its own glyphs")
+    print("App/font.c packs back to itself, {} distinct columns".format(len(columns)))
+
+    print()
+    print("flash            plain  packed")
+    plain_total = 0
+    packed_total = 2 * len(columns)
+    for name, count, width in FONTS:
+        plain_total += count * 2 * width
+        packed_total += count * width
+        print("{:<15} {:6d} {:7d}".format(name, count * 2 * width, count * width))
+    print("{:<15} {:6s} {:7d}".format(DICTIONARY, "", 2 * len(columns)))
+    print("{:<15} {:6d} {:7d}   {} bytes saved".format("total", plain_total, packed_total, plain_total - packed_total))
+
+    print()
+    print("render cycles per glyph   memcpy  decode")
+    big = 2 * memcpy_cycles(8), decode_cycles(8)
+    digit = 2 * memcpy_cycles(13), decode_cycles(13)
+    print("UI_PrintString           {:7d} {:7d}".format(*big))
+    print("UI_DisplayFrequency      {:7d} {:7d}".format(*digit))
+    # A busy main screen: two VFOs with a frequency each and two 16 character
+    # lines of text, the DTMF or channel name lines
+    old = 32 * big[0] + 12 * digit[0]
+    new = 32 * big[1] + 12 * digit[1]
+    print("main screen redraw       {:7d} {:7d}   {:+.1f} us at 48 MHz".format(old, new, (new - old) / 48))
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Column dictionary tables for App/font.c")
+    ap.add_argument("source", nargs="?", type=Path, help="C file with the plain gFontBig[95][16] and gFontBigDigits[11][26]")
+    ap.add_argument("--unpack", action="store_true", help="print the plain glyphs of App/font.c")
+    ap.add_argument("--report", action="store_true", help="check App/font.c and print flash and render costs")
+    args = ap.parse_args()
+
+    if args.report:
+        report()
+    elif args.unpack:
+        print_plain(unpack(load_tables(FONT_C)))
+    elif args.source:
+        print_packed(*pack(load_tables(args.source)))
+    else:
+        ap.error("give a SOURCE.c, --unpack or --report")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,156 @@
+#!/usr/bin/env python3
+
+# Copyright (c) 2025 muzkr
+#
+#   https://github.com/muzkr
+#
+# Licensed under the MIT License (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at the root of this repository.
+#
+#     Unless required by applicable law or agreed to in writing, software
+#     distributed under the License is distributed on an "AS IS" BASIS,
+#     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#     See the License for the specific language governing permissions and
+#     limitations under the License.
+#
+
+# Generates the boundary tables behind FREQUENCY_GetBand() (App/frequencies.c)
+# and DCS_GetCtcssCode() (App/dcs.c), and checks the binary searches over
+# them against the original range tests and nearest-tone scan.
+#
+# Usage:
+# lookup_tables.py            print the C tables
+# lookup_tables.py --verify   sweep all frequencies and tone codes
+#
+# Both lookups are step functions, so --verify evaluates the frequency
+# lookup on both sides of every place either version can change its
+# answer, plus one point inside each interval, which covers all 2^32
+# inputs. The tone lookup is swept over all 2^16 codes.
+
+import argparse
+import re
+from pathlib import Path
+
+ROOT = Path(__file__).resolve().parent.parent
+FREQUENCIES_C = ROOT / "App" / "frequencies.c"
+DCS_C = ROOT / "App" / "dcs.c"
+
+BAND_NAMES = ["BAND1_50MHz", "BAND2_108MHz", "BAND3_136MHz", "BAND4_174MHz", "BAND5_350MHz", "BAND6_400MHz", "BAND7_470MHz"]
+BAND_DEFAULT = 5  # BAND6_400MHz
+CTCSS_WINDOW = 50  # DCS_GetCtcssCode() only accepts closer tones
+
+
+def load_table(path: Path, name: str) -> list:
+    src = path.read_text()
+    start = src.index(name + "[")
+    end = src.index("};", start)
+    return [int(x, 0) for x in re.findall(r"\b(?:0x[0-9A-Fa-f]+|\d+)\b", src[src.index("{", start) : end])]
+
+
+def band_ranges():
+    lower = load_table(FREQUENCIES_C, "LowerLimitFrequencyBandTable")
+    upper = load_table(FREQUENCIES_C, "UpperLimitFrequencyBandTable")
+    return list(zip(lower, upper))
+
+
+def old_band(ranges: list, frequency: int) -> int:
+    for band, (lower, upper) in enumerate(ranges):
+        if lower <= frequency <= upper:
+            return band
+    return BAND_DEFAULT
+
+
+def band_tables(ranges: list):
+    # Every value where the range tests can change their answer
+    edges = sorted({0} | {l for l, _ in ranges} | {u + 1 for _, u in ranges})
+    starts, bands = [], []
+    for edge in edges:
+        band = old_band(ranges, edge)
+        if not bands or bands[-1] != band:
+            starts.append(edge)
+            bands.append(band)
+    return starts, bands
+
+
+def lower_bound(table: list, value: int) -> int:
+    # Index of the last entry <= value, table[0] is always <= value
+    base, n = 0, len(table)
+    while n > 1:
+        half = n // 2
+        if table[base + half] <= value:
+            base += half
+        n -= half
+    return base
+
+
+def old_ctcss(options: list, code: int) -> int:
+    smallest, result = CTCSS_WINDOW, 0xFF
+    for i, option in enumerate(options):
+        delta = abs(code - option)
+        if delta < smallest:
+            smallest, result = delta, i
+    return result
+
+
+def ctcss_table(options: list) -> list:
+    # First code that is nearer to option i than to option i - 1, ties go
+    # to the lower option as in the linear scan
+    return [0] + [(a + b) // 2 + 1 for a, b in zip(options, options[1:])]
+
+
+def new_ctcss(options: list, bounds: list, code: int) -> int:
+    i = lower_bound(bounds, code)
+    return i if abs(code - options[i]) < CTCSS_WINDOW else 0xFF
+
+
+def verify():
+    ranges = band_ranges()
+    starts, bands = band_tables(ranges)
+    points = {0, 0xFFFFFFFF}
+    for edge in starts + [l for l, _ in ranges] + [u + 1 for _, u in ranges]:
+        points |= {max(edge - 1, 0), edge, edge + 1}
+    for a, b in zip(starts, starts[1:]):
+        points.add((a + b) // 2)
+    for frequency in sorted(points):
+        if old_band(ranges, frequency) != bands[lower_bound(starts, frequency)]:
+            raise SystemExit("band mismatch at {}".format(frequency))
+    print("FREQUENCY_GetBand: {} points over {} intervals, all equal".format(len(points), len(starts)))
+
+    options = load_table(DCS_C, "CTCSS_Options")
+    if options != sorted(options):
+        raise SystemExit("CTCSS_Options is not sorted")
+    bounds = ctcss_table(options)
+    for code in range(1 << 16):
+        if old_ctcss(options, code) != new_ctcss(options, bounds, code):
+            raise SystemExit("CTCSS mismatch at {}".format(code))
+    print("DCS_GetCtcssCode: all 65536 codes equal")
+
+
+def print_table(ctype: str, name: str, values: list, fmt: str, per_line: int):
+    print("static const {} {}[{}] = {{".format(ctype, name, len(values)))
+    for i in range(0, len(values), per_line):
+        print("\t" + " ".join(fmt.format(v) + "," for v in values[i : i + per_line]))
+    print("};")
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Lookup tables for App/frequencies.c and App/dcs.c")
+    ap.add_argument("--verify", action="store_true", help="compare against the original lookups")
+    args = ap.parse_args()
+
+    if args.verify:
+        verify()
+        return
+
+    starts, bands = band_tables(band_ranges())
+    print_table("uint32_t", "BandStartTable", starts, "{:8d}", 4)
+    print()
+    print_table("uint8_t", "BandIndexTable", [BAND_NAMES[b] for b in bands], "{}", 4)
+    print()
+    bounds = ctcss_table(load_table(DCS_C, "CTCSS_Options"))
+    print_table("uint16_t", "CTCSS_Boundaries", bounds, "0x{:04X}", 4)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,146 @@
+#!/usr/bin/env python3
+
+# Copyright (c) 2025 muzkr
+#
+#   https://github.com/muzkr
+#
+# Licensed under the MIT License (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at the root of this repository.
+#
+#     Unless required by applicable law or agreed to in writing, software
+#     distributed under the License is distributed on an "AS IS" BASIS,
+#     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#     See the License for the specific language governing permissions and
+#     limitations under the License.
+#
+
+# Sweep rate of the band scope (App/app/spectrum.c) against a simulated
+# BK4819, compared with retuning through the usual RX setup path.
+#
+# Usage:
+# spectrum_bench.py [--settle-us N] [--sweeps N]
+#
+# The simulated chip costs bus time per register access like the bit-banged
+# driver (K5_Driver/driver/bk4819.c, 1 us per half clock) and only reports
+# a valid RSSI once `--settle-us` has passed since the last RX link restart.
+# The main loop also runs the 10 ms time slice and redraws the screen after
+# every sweep, which is charged to the sweep.
+#
+# Utilities/printf/test/test_spectrum.cpp runs the real SPECTRUM_Update()
+# against the same simulated chip in C; this script adds the comparison
+# with retuning through the RX setup path, which the firmware no longer has.
+
+import argparse
+import random
+
+POINTS = 128
+DWELL_US = [400, 800, 1200, 2500]
+
+# SCN + 8 address bits + 16 data bits at 3 spins per bit, plus CS and gaps
+WRITE_US = 1 + 8 * 3 + 1 + 16 * 3 + 1 + 1
+READ_US = 1 + 8 * 3 + 16 * 2 + 1
+# Per 10 ms tick: key scan, counters, status
+TIMESLICE_US = 300
+# ST7565 full screen blit
+BLIT_US = 2500
+
+
+class SimBK4819:
+    def __init__(self, settle_us: int, seed: int):
+        self.settle_us = settle_us
+        self.now_us = 0.0
+        self.freq = 0
+        self.restart_us = 0.0
+        rng = random.Random(seed)
+        # A few carriers over a noise floor, in halved RSSI units
+        self.carriers = {rng.randrange(POINTS): rng.randrange(40, 100) for _ in range(6)}
+        self.writes = 0
+        self.reads = 0
+
+    def write(self, reg: int, value: int):
+        self.now_us += WRITE_US
+        self.writes += 1
+        if reg == 0x38:
+            self.freq = (self.freq & 0xFFFF0000) | value
+        elif reg == 0x39:
+            self.freq = (self.freq & 0xFFFF) | (value << 16)
+        elif reg == 0x30 and value & 0x8000:
+            self.restart_us = self.now_us
+
+    def read_rssi(self, point: int) -> int:
+        self.now_us += READ_US
+        self.reads += 1
+        if self.now_us - self.restart_us < self.settle_us:
+            return -1
+        return self.carriers.get(point, 25)
+
+    def delay(self, us: float):
+        self.now_us += us
+
+
+def select_filter(chip: SimBK4819):
+    # Two BK4819_ToggleGpioOut() calls
+    chip.write(0x33, 0)
+    chip.write(0x33, 0)
+
+
+def retune_fast(chip: SimBK4819, freq: int, first: bool):
+    if first:
+        select_filter(chip)
+    chip.write(0x38, freq & 0xFFFF)
+    chip.write(0x39, freq >> 16)
+    chip.write(0x30, 0)
+    chip.write(0x30, 0xBFF1)
+
+
+def retune_setup(chip: SimBK4819, freq: int, first: bool):
+    # BK4819_SetFrequency(), BK4819_SelectFilter(), BK4819_RX_TurnOn()
+    chip.write(0x38, freq & 0xFFFF)
+    chip.write(0x39, freq >> 16)
+    select_filter(chip)
+    chip.write(0x37, 0x1F0F)
+    chip.write(0x30, 0)
+    chip.write(0x30, 0xBFF1)
+
+
+def sweep(retune, dwell_us: int, settle_us: int, sweeps: int):
+    chip = SimBK4819(settle_us, 1)
+    next_tick = 10000.0
+    bad = 0
+    for _ in range(sweeps):
+        freq = 14400000
+        for point in range(POINTS):
+            retune(chip, freq, point == 0)
+            chip.delay(dwell_us)
+            if chip.read_rssi(point) < 0:
+                bad += 1
+            freq += 2500
+            while chip.now_us >= next_tick:
+                chip.delay(TIMESLICE_US)
+                next_tick += 10000.0
+        chip.delay(BLIT_US)
+    points = POINTS * sweeps
+    return points / (chip.now_us / 1e6), chip.writes / points, bad
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Band scope sweep rate against a simulated BK4819")
+    ap.add_argument("--settle-us", type=int, default=600, help="RSSI settle time after an RX link restart")
+    ap.add_argument("--sweeps", type=int, default=20, help="Number of sweeps to simulate")
+    args = ap.parse_args()
+
+    print("{} points per sweep, RSSI settles after {} us".format(POINTS, args.settle_us))
+    print("dwell us   path    points/s  sweeps/s  writes/pt  unsettled")
+    for dwell in DWELL_US:
+        for name, retune in (("fast", retune_fast), ("setup", retune_setup)):
+            rate, writes, bad = sweep(retune, dwell, args.settle_us, args.sweeps)
+            print(
+                "{:8d}   {:6s}  {:8.0f}  {:8.2f}  {:9.2f}  {:9d}".format(
+                    dwell, name, rate, rate / POINTS, writes, bad
+                )
+            )
+
+
+if __name__ == "__main__":
+    main()